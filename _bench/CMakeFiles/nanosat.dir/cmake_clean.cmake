@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nanosat.dir/src/main.cpp.o"
+  "CMakeFiles/nanosat.dir/src/main.cpp.o.d"
+  "nanosat"
+  "nanosat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nanosat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
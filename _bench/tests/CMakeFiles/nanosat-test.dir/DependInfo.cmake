@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/allocation_counter.cpp" "tests/CMakeFiles/nanosat-test.dir/allocation_counter.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/allocation_counter.cpp.o.d"
+  "/root/repo/tests/main.cpp" "tests/CMakeFiles/nanosat-test.dir/main.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/main.cpp.o.d"
+  "/root/repo/tests/nanosat_alloc_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_alloc_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_alloc_test.cpp.o.d"
+  "/root/repo/tests/nanosat_clauses_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_clauses_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_clauses_test.cpp.o.d"
+  "/root/repo/tests/nanosat_heap_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_heap_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_heap_test.cpp.o.d"
+  "/root/repo/tests/nanosat_inprocessing_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_inprocessing_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_inprocessing_test.cpp.o.d"
+  "/root/repo/tests/nanosat_parse_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_parse_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_parse_test.cpp.o.d"
+  "/root/repo/tests/nanosat_phases_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_phases_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_phases_test.cpp.o.d"
+  "/root/repo/tests/nanosat_reconstruction_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_reconstruction_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_reconstruction_test.cpp.o.d"
+  "/root/repo/tests/nanosat_restart_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_restart_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_restart_test.cpp.o.d"
+  "/root/repo/tests/nanosat_sat_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_sat_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_sat_test.cpp.o.d"
+  "/root/repo/tests/nanosat_vmtf_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_vmtf_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_vmtf_test.cpp.o.d"
+  "/root/repo/tests/nanosat_watches_test.cpp" "tests/CMakeFiles/nanosat-test.dir/nanosat_watches_test.cpp.o" "gcc" "tests/CMakeFiles/nanosat-test.dir/nanosat_watches_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench/external/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_bench/external/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
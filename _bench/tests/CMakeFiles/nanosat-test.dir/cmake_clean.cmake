@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nanosat-test.dir/allocation_counter.cpp.o"
+  "CMakeFiles/nanosat-test.dir/allocation_counter.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/main.cpp.o"
+  "CMakeFiles/nanosat-test.dir/main.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_alloc_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_alloc_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_clauses_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_clauses_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_heap_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_heap_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_inprocessing_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_inprocessing_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_parse_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_parse_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_phases_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_phases_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_reconstruction_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_reconstruction_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_restart_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_restart_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_sat_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_sat_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_vmtf_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_vmtf_test.cpp.o.d"
+  "CMakeFiles/nanosat-test.dir/nanosat_watches_test.cpp.o"
+  "CMakeFiles/nanosat-test.dir/nanosat_watches_test.cpp.o.d"
+  "nanosat-test"
+  "nanosat-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nanosat-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -55,6 +56,9 @@ class Literal {
   /// Default constructors private
   constexpr explicit Literal(Variable x) : x(x) {}
 
+  /// Clause headers in the clause arena are stored as raw words
+  friend class Clause;
+
  public:
   /// Default constructor creates invalid literal
   constexpr Literal() : x(INVALID) {}
@@ -82,89 +86,297 @@ class Literal {
   constexpr bool valid() const noexcept { return x != INVALID; }
 };
 
-/// Reference to a clause
+/// Current assignment, stored per literal: 1 if true, -1 if false, 0 if
+/// unset; a literal and its negation always hold opposite values, so that
+/// testing a literal is a single load without decoding its polarity
+class LiteralValues {
+ private:
+  /// Value of each literal, indexed by literal
+  std::vector<std::int8_t> values;
+
+ public:
+  LiteralValues() : values() {}
+
+  /// Add unset literals up to `num_variables` variables
+  void resize(std::size_t num_variables) {
+    values.resize(2 * num_variables, 0);
+  }
+
+  /// Whether literal is true
+  bool isTrue(Literal literal) const noexcept { return values[literal] > 0; }
+  /// Whether literal is false
+  bool isFalse(Literal literal) const noexcept { return values[literal] < 0; }
+  /// Whether literal is unset
+  bool isUnset(Literal literal) const noexcept { return values[literal] == 0; }
+
+  /// Value of a variable, i.e., of its positive literal
+  VariableValue value(Variable var) const noexcept {
+    auto value = values[Literal(var, true)];
+    return value == 0 ? VariableValue() : VariableValue(value > 0);
+  }
+
+  /// Make literal true and its negation false
+  void assign(Literal literal) noexcept {
+    assert(values[literal] == 0 && values[~literal] == 0);
+    values[literal] = 1;
+    values[~literal] = -1;
+  }
+
+  /// Unset literal and its negation
+  void unassign(Literal literal) noexcept {
+    assert(values[literal] == -values[~literal] && values[literal] != 0);
+    values[literal] = 0;
+    values[~literal] = 0;
+  }
+};
+
+/// Reference to a clause; offset of the clause header in the clause arena
 class ClauseRef {
  private:
   /// Invalid representation
   static constexpr std::uint32_t INVALID = -1;
-  /// Even indices are original clauses; odd indices are learned clauses
+  /// Offset into the clause arena
   std::uint32_t x;
 
  public:
   constexpr ClauseRef() : x(INVALID) {}
   /// New clause reference
-  constexpr ClauseRef(std::uint32_t index, bool is_learned)
-      : x(2 * index + is_learned) {}
+  constexpr explicit ClauseRef(std::uint32_t offset) : x(offset) {}
 
   /// Equality
   constexpr bool operator==(ClauseRef cr) const noexcept { return x == cr.x; }
 
-  /// Index
-  constexpr std::uint32_t idx() const noexcept { return x >> 1; }
-  /// Whether clause is learned
-  constexpr bool isLearned() const noexcept { return x & 1; }
+  /// Offset into the clause arena
+  constexpr std::uint32_t offset() const noexcept { return x; }
   /// Whether is valid
   constexpr bool valid() const noexcept { return x != INVALID; }
 };
 
-/// Class managing the creation, deletion, and access of clauses
+/// View of a clause in the clause arena; the clause header is stored
+/// directly in front of the literals of the clause
+class Clause {
+ private:
+  /// Header word containing the number of literals
+  static constexpr std::size_t SIZE_WORD = 0;
+  /// Header word containing the clause flags
+  static constexpr std::size_t FLAGS_WORD = 1;
+  /// Header word containing the clause activity
+  static constexpr std::size_t ACTIVITY_WORD = 2;
+  /// Flag for learned clauses
+  static constexpr std::uint32_t LEARNED_FLAG = 1;
+  /// Flag for deleted clauses
+  static constexpr std::uint32_t DELETED_FLAG = 2;
+  /// Flag for clauses moved to another arena; the new location is stored in
+  /// the activity word
+  static constexpr std::uint32_t RELOCATED_FLAG = 4;
+  /// Position of the usage counter in the flags word
+  static constexpr std::uint32_t USED_SHIFT = 3;
+  /// Mask of the usage counter (after shifting)
+  static constexpr std::uint32_t USED_MASK = 3;
+  /// Flag for learned clauses that have been vivified (above the usage
+  /// counter)
+  static constexpr std::uint32_t VIVIFIED_FLAG = 32;
+  /// Position of the literal block distance in the flags word
+  static constexpr std::uint32_t LBD_SHIFT = 8;
+  /// Maximum stored literal block distance
+  static constexpr std::uint32_t MAX_LBD = (1u << (32 - LBD_SHIFT)) - 1;
+
+  /// Pointer to the clause header
+  Literal* header;
+
+ public:
+  /// Number of header words in front of the literals
+  static constexpr std::size_t HEADER_SIZE = 3;
+
+  /// View of the clause starting at `header`
+  constexpr explicit Clause(Literal* header) : header(header) {}
+
+  /// Initializes the header of a new clause
+  constexpr void initHeader(std::uint32_t size, bool is_learned) noexcept {
+    header[SIZE_WORD].x = size;
+    header[FLAGS_WORD].x = is_learned ? LEARNED_FLAG : 0;
+    header[ACTIVITY_WORD].x = std::bit_cast<std::uint32_t>(0.0f);
+  }
+
+  /// Number of literals
+  constexpr std::uint32_t size() const noexcept { return header[SIZE_WORD].x; }
+  /// Whether clause is learned
+  constexpr bool isLearned() const noexcept {
+    return header[FLAGS_WORD].x & LEARNED_FLAG;
+  }
+  /// Whether clause is deleted
+  constexpr bool isDeleted() const noexcept {
+    return header[FLAGS_WORD].x & DELETED_FLAG;
+  }
+  /// Mark clause as deleted
+  constexpr void markDeleted() noexcept {
+    header[FLAGS_WORD].x |= DELETED_FLAG;
+  }
+
+  /// Whether clause has been vivified
+  constexpr bool isVivified() const noexcept {
+    return header[FLAGS_WORD].x & VIVIFIED_FLAG;
+  }
+  /// Mark clause as vivified
+  constexpr void markVivified() noexcept {
+    header[FLAGS_WORD].x |= VIVIFIED_FLAG;
+  }
+
+  /// Whether clause has been moved to another arena
+  constexpr bool isRelocated() const noexcept {
+    return header[FLAGS_WORD].x & RELOCATED_FLAG;
+  }
+  /// New location of a relocated clause
+  constexpr ClauseRef relocation() const noexcept {
+    assert(isRelocated());
+    return ClauseRef(header[ACTIVITY_WORD].x);
+  }
+  /// Mark clause as moved to `new_location`
+  constexpr void markRelocated(ClauseRef new_location) noexcept {
+    header[FLAGS_WORD].x |= RELOCATED_FLAG;
+    header[ACTIVITY_WORD].x = new_location.offset();
+  }
+
+  /// Literal block distance (number of distinct decision levels) of a
+  /// learned clause when it was last used
+  constexpr std::uint32_t lbd() const noexcept {
+    return header[FLAGS_WORD].x >> LBD_SHIFT;
+  }
+  /// Set literal block distance; values are capped at `MAX_LBD`
+  constexpr void setLbd(std::uint32_t lbd) noexcept {
+    lbd = lbd < MAX_LBD ? lbd : MAX_LBD;
+    header[FLAGS_WORD].x =
+        (header[FLAGS_WORD].x & ((1u << LBD_SHIFT) - 1)) | (lbd << LBD_SHIFT);
+  }
+
+  /// Number of reductions the learned clause survives without being used
+  constexpr std::uint32_t used() const noexcept {
+    return (header[FLAGS_WORD].x >> USED_SHIFT) & USED_MASK;
+  }
+  /// Set usage counter (at most `USED_MASK`)
+  constexpr void setUsed(std::uint32_t used) noexcept {
+    assert(used <= USED_MASK);
+    header[FLAGS_WORD].x = (header[FLAGS_WORD].x & ~(USED_MASK << USED_SHIFT)) |
+                           (used << USED_SHIFT);
+  }
+
+  /// Clause activity
+  constexpr float activity() const noexcept {
+    return std::bit_cast<float>(header[ACTIVITY_WORD].x);
+  }
+  /// Set clause activity
+  constexpr void setActivity(float activity) noexcept {
+    header[ACTIVITY_WORD].x = std::bit_cast<std::uint32_t>(activity);
+  }
+
+  /// Literal at position `i`
+  constexpr Literal& operator[](std::size_t i) const noexcept {
+    assert(i < size());
+    return header[HEADER_SIZE + i];
+  }
+  /// Begin of literals
+  constexpr Literal* begin() const noexcept { return header + HEADER_SIZE; }
+  /// End of literals
+  constexpr Literal* end() const noexcept { return begin() + size(); }
+  /// Last literal
+  constexpr Literal& back() const noexcept { return (*this)[size() - 1]; }
+
+  /// 64-bit signature of the variables in the clause; if the variables of
+  /// a clause are a subset of another's, so are the signature bits
+  constexpr std::uint64_t signature() const noexcept {
+    std::uint64_t signature = 0;
+    for (auto literal : *this) {
+      signature |= std::uint64_t{1} << (literal.var() % 64);
+    }
+    return signature;
+  }
+
+  /// Shrinks the clause to `new_size` literals
+  constexpr void shrink(std::uint32_t new_size) noexcept {
+    assert(new_size <= size());
+    header[SIZE_WORD].x = new_size;
+  }
+};
+
+/// Arena managing the creation, deletion, and access of all clauses;
+/// clauses are stored contiguously as header followed by literals
 class Clauses {
  private:
-  /// Stores all clauses
-  std::vector<std::vector<Literal>> clauses;
-  /// Stores indices of empty vectors
-  std::vector<std::uint32_t> free_indices_clauses;
-  /// Stores clause activities
-  std::vector<double> activities;
+  /// Stores all clause headers and literals
+  std::vector<Literal> arena;
+  /// Number of arena words occupied by deleted or shrunk clauses
+  std::size_t wasted_words;
 
  public:
   /// Create clause management
-  Clauses() : clauses(), free_indices_clauses(), activities() {}
-
-  /// Size
-  constexpr std::uint32_t size() const noexcept { return clauses.size(); }
-
-  /// Copy (lvalue) or move (rvalue) clause into container
-  ClauseRef addClause(std::vector<Literal> literals, bool is_learned_clause) {
-    // Use free slot
-    if (!free_indices_clauses.empty()) {
-      auto idx = free_indices_clauses.back();
-      free_indices_clauses.pop_back();
-      clauses[idx] = std::move(literals);
-      activities[idx] = 0.0;
-      return {idx, is_learned_clause};
-    }
+  Clauses() : arena(), wasted_words(0) {}
 
-    // Append at the end
-    std::uint32_t idx = clauses.size();
-    clauses.push_back(std::move(literals));
-    activities.push_back(0.0);
-    return {idx, is_learned_clause};
+  /// Number of arena words in use (including wasted ones)
+  constexpr std::size_t size() const noexcept { return arena.size(); }
+  /// Number of arena words occupied by deleted or shrunk clauses
+  constexpr std::size_t wasted() const noexcept { return wasted_words; }
+  /// Number of arena words that fit without reallocating the arena
+  constexpr std::size_t capacity() const noexcept { return arena.capacity(); }
+
+  /// Reserve space for `num_words` arena words
+  void reserve(std::size_t num_words) { arena.reserve(num_words); }
+
+  /// Remove all clauses keeping the capacity of the arena
+  void clear() {
+    arena.clear();
+    wasted_words = 0;
+  }
+
+  /// Copy clause into the arena
+  ClauseRef addClause(const std::vector<Literal>& literals,
+                      bool is_learned_clause) {
+    assert(arena.size() + Clause::HEADER_SIZE + literals.size() <
+           static_cast<std::uint32_t>(-1));
+    ClauseRef clause_ref(arena.size());
+    arena.resize(arena.size() + Clause::HEADER_SIZE);
+    arena.insert(arena.end(), literals.begin(), literals.end());
+    (*this)[clause_ref].initHeader(literals.size(), is_learned_clause);
+    return clause_ref;
   }
 
-  /// Remove clause
+  /// Remove clause; its arena words are wasted until the arena is compacted
   void removeClause(ClauseRef clause_ref) {
-    auto idx = clause_ref.idx();
-    if (idx == clauses.size() - 1) {
-      clauses.pop_back();
-      activities.pop_back();
-    } else {
-      clauses[idx].clear();
-      activities[idx] = 0.0;
-      free_indices_clauses.push_back(idx);
-    }
+    auto clause = (*this)[clause_ref];
+    assert(!clause.isDeleted());
+    clause.markDeleted();
+    wasted_words += Clause::HEADER_SIZE + clause.size();
   }
 
-  /// Clause at given index
-  std::vector<Literal>& operator[](ClauseRef clause_ref) {
-    assert(clause_ref.valid());
-    return clauses.at(clause_ref.idx());
+  /// Shrink clause to `new_size` literals
+  void shrinkClause(ClauseRef clause_ref, std::uint32_t new_size) {
+    auto clause = (*this)[clause_ref];
+    wasted_words += clause.size() - new_size;
+    clause.shrink(new_size);
   }
 
-  /// Clause activity at given index
-  double& activity(ClauseRef clause_ref) {
+  /// Move clause to the end of the arena `to` unless it has already been
+  /// moved; returns the new reference of the clause
+  ClauseRef relocate(ClauseRef clause_ref, Clauses& to) {
+    auto clause = (*this)[clause_ref];
+    assert(!clause.isDeleted());
+    if (clause.isRelocated()) {
+      return clause.relocation();
+    }
+
+    // Copy header and literals
+    ClauseRef new_clause_ref(to.arena.size());
+    auto begin = arena.begin() + clause_ref.offset();
+    to.arena.insert(to.arena.end(), begin,
+                    begin + Clause::HEADER_SIZE + clause.size());
+    clause.markRelocated(new_clause_ref);
+    return new_clause_ref;
+  }
+
+  /// Clause at given reference
+  Clause operator[](ClauseRef clause_ref) {
     assert(clause_ref.valid());
-    return activities.at(clause_ref.idx());
+    assert(clause_ref.offset() < arena.size());
+    return Clause(arena.data() + clause_ref.offset());
   }
 };
 
@@ -184,12 +396,116 @@ struct Watch {
   }
 };
 
-/// Store metadata for a variable
+/// Clause connected to the occurrence list of one of its literals during
+/// subsumption, together with its signature for fast rejection
+struct Occurrence {
+  ClauseRef clause_ref;
+  std::uint64_t signature;
+
+  constexpr Occurrence(ClauseRef clause_ref, std::uint64_t signature)
+      : clause_ref(clause_ref), signature(signature) {}
+};
+
+/// Binary clause stored as implication; if the literal whose list contains
+/// the implication becomes true, `implied` must become true as well
+struct Implication {
+  Literal implied;
+  bool is_learned;
+
+  constexpr Implication() : implied(), is_learned(false) {}
+  constexpr Implication(Literal implied, bool is_learned)
+      : implied(implied), is_learned(is_learned) {}
+};
+
+/// Reason of a variable assignment; either a clause in the clause arena or,
+/// for binary clauses, the literal implying the assignment; packed into one
+/// word, so clause offsets and literals must be below `BINARY_FLAG`
+class Reason {
+ private:
+  /// Invalid representation
+  static constexpr std::uint32_t INVALID = -1;
+  /// Set for the implying literal of a binary clause
+  static constexpr std::uint32_t BINARY_FLAG = std::uint32_t{1} << 31;
+  /// Offset of the reason clause, or implying literal with `BINARY_FLAG`
+  std::uint32_t x;
+
+ public:
+  /// No reason (decision or unit)
+  constexpr Reason() : x(INVALID) {}
+  /// Clause as reason
+  constexpr Reason(ClauseRef clause_ref) : x(clause_ref.offset()) {
+    assert(!clause_ref.valid() || x < BINARY_FLAG);
+  }
+  /// Binary clause `(implied or not implying_literal)` as reason
+  constexpr Reason(Literal implying_literal)
+      : x(static_cast<std::uint32_t>(implying_literal) | BINARY_FLAG) {
+    assert(!implying_literal.valid() ||
+           implying_literal.var() < (BINARY_FLAG >> 1) - 1);
+  }
+
+  /// Equality
+  constexpr bool operator==(Reason r) const noexcept { return x == r.x; }
+
+  /// Whether is valid
+  constexpr bool valid() const noexcept { return x != INVALID; }
+  /// Whether reason is a clause in the clause arena
+  constexpr bool isClause() const noexcept { return x < BINARY_FLAG; }
+  /// Whether reason is a binary clause
+  constexpr bool isBinary() const noexcept {
+    return x >= BINARY_FLAG && x != INVALID;
+  }
+  /// Reason clause
+  constexpr ClauseRef clauseRef() const noexcept {
+    return isClause() ? ClauseRef(x) : ClauseRef();
+  }
+  /// Implying literal of a binary clause
+  constexpr Literal implyingLiteral() const noexcept {
+    return isBinary() ? Literal((x & ~BINARY_FLAG) >> 1, x & 1) : Literal();
+  }
+};
+
+/// Conflict found during propagation; the conflicting clause is the reason
+/// that would have implied the already falsified `literal`
+struct Conflict {
+  Reason reason;
+  Literal literal;
+
+  constexpr Conflict() : reason(), literal() {}
+  constexpr Conflict(Reason reason, Literal literal)
+      : reason(reason), literal(literal) {}
+
+  /// Whether is valid
+  constexpr bool valid() const noexcept { return reason.valid(); }
+};
+
+/// Status of a variable during conflict analysis
+enum class VariableStatus : std::uint8_t {
+  /// Variable does not participate in conflict
+  UNSET = 0,
+  /// Variable is a source of conflict
+  IS_SOURCE = 1,
+  /// Variable causes a conflict but could be removed
+  REMOVABLE = 2,
+  /// Removing variable failed
+  REMOVAL_FAILED = 3,
+  /// Variable is resolved away when shrinking a decision level
+  SHRINKABLE = 4,
+};
+
+/// Store metadata for a variable; the fields accessed together when
+/// assigning, analyzing conflicts and backtracking share one 16 byte record
 struct VariableMetadata {
-  /// Link to a clause
-  ClauseRef reason_clause_idx;
+  /// Reason for the assignment
+  Reason reason;
   /// The associated decision level for a variable assignment
   std::uint32_t decision_level;
+  /// Position of the assignment in the trail
+  std::uint32_t trail_index;
+  /// Status during conflict analysis
+  VariableStatus seen;
+  /// Preferred polarity when deciding the variable (phase saving)
+  bool phase;
 };
+static_assert(sizeof(VariableMetadata) == 16);
 
 }  // namespace ns::clauses
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace ns::solver::heap {
+
+/// Indexed binary max-heap of variables ordered by their scores
+class Heap {
+ private:
+  /// Position of variables not contained in the heap
+  static constexpr std::uint32_t NOT_CONTAINED = -1;
+
+  /// Score of each variable
+  std::vector<double> scores;
+  /// Binary heap of variables; the variable with the highest score is first
+  std::vector<clauses::Variable> heap;
+  /// Position of each variable in `heap`
+  std::vector<std::uint32_t> positions;
+
+  /// Move variable at position `i` up until the heap property holds
+  void siftUp(std::uint32_t i) {
+    auto var = heap[i];
+    while (i > 0) {
+      auto parent = (i - 1) / 2;
+      if (scores[heap[parent]] >= scores[var]) {
+        break;
+      }
+      heap[i] = heap[parent];
+      positions[heap[i]] = i;
+      i = parent;
+    }
+    heap[i] = var;
+    positions[var] = i;
+  }
+
+  /// Move variable at position `i` down until the heap property holds
+  void siftDown(std::uint32_t i) {
+    auto var = heap[i];
+    while (2 * i + 1 < heap.size()) {
+      auto child = 2 * i + 1;
+      if (child + 1 < heap.size() &&
+          scores[heap[child + 1]] > scores[heap[child]]) {
+        ++child;
+      }
+      if (scores[heap[child]] <= scores[var]) {
+        break;
+      }
+      heap[i] = heap[child];
+      positions[heap[i]] = i;
+      i = child;
+    }
+    heap[i] = var;
+    positions[var] = i;
+  }
+
+ public:
+  /// Create empty heap
+  Heap() : scores(), heap(), positions() {}
+
+  /// Support variables `0..num_variables-1`; new variables have score zero
+  /// and are not contained in the heap
+  void resize(std::uint32_t num_variables) {
+    scores.resize(num_variables, 0.0);
+    positions.resize(num_variables, NOT_CONTAINED);
+    heap.reserve(num_variables);
+  }
+
+  /// Whether the heap is empty
+  constexpr bool empty() const noexcept { return heap.empty(); }
+  /// Number of contained variables
+  constexpr std::size_t size() const noexcept { return heap.size(); }
+  /// Whether variable is contained in the heap
+  constexpr bool contains(clauses::Variable var) const noexcept {
+    return positions[var] != NOT_CONTAINED;
+  }
+  /// Score of variable
+  constexpr double score(clauses::Variable var) const noexcept {
+    return scores[var];
+  }
+
+  /// Insert variable (must not be contained)
+  void insert(clauses::Variable var) {
+    assert(!contains(var));
+    heap.push_back(var);
+    siftUp(heap.size() - 1);
+  }
+
+  /// Variable with the highest score
+  constexpr clauses::Variable top() const noexcept {
+    assert(!empty());
+    return heap[0];
+  }
+
+  /// Remove and return the variable with the highest score
+  clauses::Variable pop() {
+    auto var = top();
+    positions[var] = NOT_CONTAINED;
+    auto last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+      heap[0] = last;
+      positions[last] = 0;
+      siftDown(0);
+    }
+    return var;
+  }
+
+  /// Remove a contained variable
+  void remove(clauses::Variable var) {
+    assert(contains(var));
+    auto i = positions[var];
+    positions[var] = NOT_CONTAINED;
+    auto last = heap.back();
+    heap.pop_back();
+    if (last != var) {
+      heap[i] = last;
+      positions[last] = i;
+      siftUp(i);
+      siftDown(positions[last]);
+    }
+  }
+
+  /// Set the score of a variable and restore the heap property
+  void update(clauses::Variable var, double new_score) {
+    auto old_score = scores[var];
+    scores[var] = new_score;
+    if (!contains(var)) {
+      return;
+    }
+    if (new_score > old_score) {
+      siftUp(positions[var]);
+    } else {
+      siftDown(positions[var]);
+    }
+  }
+
+  /// Multiply all scores by `factor > 0`; the order is unchanged
+  void rescale(double factor) {
+    for (auto& score : scores) {
+      score *= factor;
+    }
+  }
+};
+
+}  // namespace ns::solver::heap
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ns::solver::inprocessing {
+
+/// Schedule of an inprocessing pass; the pass runs after an increasing
+/// number of conflicts and may spend a fraction of the search ticks since
+/// its last run (ticks count the memory accessed by propagation and the
+/// simplification passes, see `SolverStatistics::num_ticks`)
+class Schedule {
+ private:
+  /// Increment of the number of conflicts between two runs
+  std::uint64_t increment;
+  /// Number of conflicts between the last and the next run
+  std::uint64_t interval;
+  /// Total number of conflicts at which to run next
+  std::uint64_t next_conflicts;
+  /// Fraction of the search ticks the pass may spend
+  double effort;
+  /// Minimum tick budget of a run
+  std::uint64_t min_ticks;
+  /// Number of search ticks at the last run
+  std::uint64_t last_search_ticks;
+
+ public:
+  /// Schedule first running after `first` conflicts
+  constexpr Schedule(std::uint64_t first, std::uint64_t increment,
+                     double effort, std::uint64_t min_ticks)
+      : increment(increment),
+        interval(first),
+        next_conflicts(first),
+        effort(effort),
+        min_ticks(min_ticks),
+        last_search_ticks(0) {}
+
+  /// Whether the pass is due after `num_conflicts` conflicts
+  constexpr bool isDue(std::uint64_t num_conflicts) const noexcept {
+    return num_conflicts >= next_conflicts;
+  }
+
+  /// Tick budget of a run after `search_ticks` search ticks in total
+  constexpr std::uint64_t budget(std::uint64_t search_ticks) const noexcept {
+    return std::max(min_ticks, static_cast<std::uint64_t>(
+                                   effort * static_cast<double>(
+                                                search_ticks -
+                                                last_search_ticks)));
+  }
+
+  /// Record a run and compute the next one
+  constexpr void onRun(std::uint64_t num_conflicts,
+                       std::uint64_t search_ticks) noexcept {
+    interval += increment;
+    next_conflicts = num_conflicts + interval;
+    last_search_ticks = search_ticks;
+  }
+};
+
+/// Schedule of the removal of satisfied clauses at decision level 0 (like
+/// `simpDB_props` of MiniSat): a run is only due if there are new top-level
+/// assignments since the last run and about as many literals have been
+/// propagated as there were literals in the clauses at the last run
+class SimplifySchedule {
+ private:
+  /// Number of top-level assignments at the last run
+  std::int64_t last_num_assigned;
+  /// Number of propagations until the next run is allowed
+  std::int64_t propagation_budget;
+
+ public:
+  /// Schedule whose first run is due immediately
+  constexpr SimplifySchedule() : last_num_assigned(-1), propagation_budget(0) {}
+
+  /// Whether a run is due with `num_assigned` top-level assignments
+  constexpr bool isDue(std::int64_t num_assigned) const noexcept {
+    return num_assigned != last_num_assigned && propagation_budget <= 0;
+  }
+
+  /// Record the propagation of a literal
+  constexpr void onPropagation() noexcept { --propagation_budget; }
+
+  /// Record a run with `num_assigned` top-level assignments and
+  /// `num_literals` literals in all clauses
+  constexpr void onRun(std::int64_t num_assigned,
+                       std::int64_t num_literals) noexcept {
+    last_num_assigned = num_assigned;
+    propagation_budget = num_literals;
+  }
+};
+
+}  // namespace ns::solver::inprocessing
@@ -52,10 +52,70 @@ inline void printElapsedTime(const solver::Solver& solver, TimePoint start_time,
                "]==============================\n"
             << "|                                                              "
                "               |\n"
+            << std::format(
+                   "|  #Subsumed clauses:    {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_subsumed_clauses)
+            << std::format(
+                   "|  #Strengthened:        {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_strengthened_clauses)
+            << std::format(
+                   "|  #Substituted vars:    {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_substituted_variables)
+            << std::format(
+                   "|  #Eliminated vars:     {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_eliminated_variables)
+            << std::format(
+                   "|  #Blocked clauses:     {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_blocked_clauses)
+            << std::format(
+                   "|  #Failed literals:     {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_failed_literals)
+            << std::format(
+                   "|  #Hyper binaries:      {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_hyper_binary_resolvents)
+            << std::format(
+                   "|  #Vivified clauses:    {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_vivified_clauses)
+            << std::format(
+                   "|  #Shrunk literals:     {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_shrunk_literals)
+            << std::format(
+                   "|  #Binary minimized:    {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_binary_minimized_literals)
+            << std::format(
+                   "|  #Simplifications:     {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_simplifications)
+            << std::format(
+                   "|  #Inprocessings:       {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_inprocessings)
             << std::format(
                    "|  #Restarts:            {:>12}                         "
                    "                |\n",
                    solver.statistics().num_restarts)
+            << std::format(
+                   "|  #Reused levels:       {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_reused_levels)
+            << std::format(
+                   "|  #Mode switches:       {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_mode_switches)
+            << std::format(
+                   "|  #Rephases:            {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_rephases)
             << std::format(
                    "|  #Conflicts:           {:>12} ({:>12.3f}/sec)      "
                    "                |\n",
@@ -70,6 +130,14 @@ inline void printElapsedTime(const solver::Solver& solver, TimePoint start_time,
                    "                |\n",
                    solver.statistics().num_propagations,
                    solver.statistics().num_propagations / elapsed_time)
+            << std::format(
+                   "|  #Ticks:               {:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_ticks)
+            << std::format(
+                   "|  #Simplification ticks:{:>12}                         "
+                   "                |\n",
+                   solver.statistics().num_simplification_ticks)
             << std::format(
                    "|  Total time:           {:>12.6f}                         "
                    "                |\n",
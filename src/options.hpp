@@ -1,19 +1,120 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace ns::options {
 
+/// Available decision heuristics
+enum class DecisionHeuristic : std::uint8_t {
+  /// Exponential variable state independent decaying sum
+  VSIDS = 0,
+  /// Variable move-to-front
+  VMTF = 1,
+};
+
+/// Decision heuristic used for branching in focused mode; stable mode
+/// always uses VSIDS
+constexpr DecisionHeuristic FOCUSED_DECISION_HEURISTIC =
+    DecisionHeuristic::VSIDS;
+
+/// Variable activity decay (focused mode)
+constexpr double VARIABLE_ACTIVITY_DECAY = 0.95;
+/// Variable activity decay in stable mode; slower to keep the search stable
+constexpr double STABLE_VARIABLE_ACTIVITY_DECAY = 0.975;
 /// Clause activity decay
 constexpr double CLAUSE_ACTIVITY_DECAY = 0.999;
-/// Fraction of learned clauses compared to original clauses
-constexpr double MAX_LEARNED_CLAUSES_FACTOR = 1.0 / 3.0;
-/// Increment of the maximum number of learned clauses
-constexpr double MAX_LEARNED_CLAUSES_INCREMENT = 1.1;
-/// After how many conflicts to adjust the
-/// maximum number of learned clauses again
-constexpr double MAX_LEARNED_ADJUST_INCREMENT = 1.5;
-/// The base restart interval
-constexpr int RESTART_FIRST = 100;
-/// The restart interval increase factor
-constexpr double RESTART_INC = 2.0;
+/// Learned clauses with at most this LBD are kept forever (core tier)
+constexpr std::uint32_t CORE_LBD = 2;
+/// Learned clauses with at most this LBD are kept while used (tier 2)
+constexpr std::uint32_t TIER2_LBD = 6;
+/// Number of reductions a tier-2 clause survives without being used
+constexpr std::uint32_t TIER2_USED = 2;
+/// Number of conflicts before the first reduction of learned clauses
+constexpr std::uint64_t REDUCE_FIRST = 2000;
+/// Increment of the number of conflicts between reductions
+constexpr std::uint64_t REDUCE_INCREMENT = 300;
+/// Fraction of the reducible learned clauses deleted in a reduction
+constexpr double REDUCE_FRACTION = 0.5;
+/// Increment of the number of conflicts between progress log lines
+constexpr double PROGRESS_LOG_INCREMENT = 1.5;
+/// Fraction of wasted clause arena words that triggers a garbage collection
+constexpr double GARBAGE_FRACTION = 0.2;
+/// Number of conflicts spent in the first focused and stable mode
+constexpr std::uint64_t MODE_FIRST = 1000;
+/// Growth factor of the mode length after each pair of modes
+constexpr double MODE_INCREMENT = 2.0;
+/// Size of a cache line in bytes; the unit of the ticks spent on scanning
+/// lists
+constexpr std::size_t CACHE_LINE_BYTES = 64;
+/// Ticks per literal of the formula that each preprocessing pass may spend
+constexpr double PREPROCESS_EFFORT = 20.0;
+/// Minimum number of ticks of a preprocessing pass
+constexpr std::uint64_t PREPROCESS_MIN_TICKS = 1000000;
+/// Clauses with more literals are not checked for subsumption
+constexpr std::uint32_t SUBSUME_CLAUSE_SIZE_LIMIT = 100;
+/// Number of conflicts before the first subsumption during search
+constexpr std::uint64_t SUBSUME_FIRST = 10000;
+/// Increment of the number of conflicts between subsumptions
+constexpr std::uint64_t SUBSUME_INCREMENT = 10000;
+/// Fraction of the search ticks that subsumption may spend
+constexpr double SUBSUME_EFFORT = 0.1;
+/// Minimum number of ticks of a subsumption round
+constexpr std::uint64_t SUBSUME_MIN_TICKS = 1000000;
+/// Number of conflicts before the first failed-literal probing during search
+constexpr std::uint64_t PROBE_FIRST = 5000;
+/// Increment of the number of conflicts between probings
+constexpr std::uint64_t PROBE_INCREMENT = 5000;
+/// Fraction of the search ticks that probing may spend
+constexpr double PROBE_EFFORT = 0.1;
+/// Minimum number of ticks of a probing round
+constexpr std::uint64_t PROBE_MIN_TICKS = 1000000;
+/// Maximum number of hyper-binary resolvents added by a probing round; they
+/// are learned binary clauses, which are never reduced
+constexpr std::uint64_t PROBE_MAX_HYPER_BINARIES = 1000;
+/// Number of conflicts before the first vivification of learned clauses
+constexpr std::uint64_t VIVIFY_FIRST = 3000;
+/// Increment of the number of conflicts between vivifications
+constexpr std::uint64_t VIVIFY_INCREMENT = 3000;
+/// Fraction of the search ticks that vivification may spend
+constexpr double VIVIFY_EFFORT = 0.05;
+/// Minimum number of ticks of a vivification round
+constexpr std::uint64_t VIVIFY_MIN_TICKS = 50000;
+/// Maximum number of clauses containing a literal for eliminating its
+/// variable
+constexpr std::uint32_t ELIM_OCCURRENCE_LIMIT = 16;
+/// Maximum size of resolvents when eliminating variables
+constexpr std::uint32_t ELIM_CLAUSE_SIZE_LIMIT = 20;
+/// Maximum number of clauses containing the negated literal for checking
+/// whether clauses are blocked on a literal
+constexpr std::uint32_t BLOCK_OCCURRENCE_LIMIT = 64;
+/// Maximum number of passes over all variables when eliminating variables
+constexpr std::uint32_t ELIM_ROUNDS = 3;
+/// Backtrack only one level if a conflict would jump back more levels
+constexpr std::uint32_t CHRONO_BACKTRACK_THRESHOLD = 100;
+/// Number of conflicts before the first rephasing
+constexpr std::uint64_t REPHASE_FIRST = 1000;
+/// Increment of the number of conflicts between rephasings
+constexpr std::uint64_t REPHASE_INCREMENT = 1000;
+/// Seed of the random number generator used for random phases
+constexpr std::uint32_t RANDOM_SEED = 91648253;
+/// Unit of the Luby restart intervals in stable mode (in conflicts)
+constexpr std::uint64_t STABLE_RESTART_FIRST = 1024;
+/// Base of the Luby restart sequence in stable mode
+constexpr double STABLE_RESTART_INC = 2.0;
+/// Smoothing factor of the fast moving average of learned clause LBDs
+constexpr double RESTART_FAST_LBD_ALPHA = 0.03;
+/// Smoothing factor of the slow moving average of learned clause LBDs
+constexpr double RESTART_SLOW_LBD_ALPHA = 1e-5;
+/// Restart if the fast LBD average exceeds the slow one by this factor
+constexpr double RESTART_MARGIN = 1.25;
+/// Minimum number of conflicts between restarts
+constexpr std::uint64_t RESTART_MIN_CONFLICTS = 50;
+/// Smoothing factor of the moving average of the trail size at conflicts
+constexpr double RESTART_TRAIL_ALPHA = 1.0 / 5000.0;
+/// Block restarts if the trail exceeds its average by this factor
+constexpr double RESTART_BLOCK_MARGIN = 1.4;
+/// Number of conflicts before restarts may be blocked
+constexpr std::uint64_t RESTART_BLOCK_CONFLICTS = 10000;
 
 }  // namespace ns::options
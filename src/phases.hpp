@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace ns::solver::phases {
+
+/// Target phases of stable mode (Biere, Fleury 2020): the polarities of the
+/// largest conflict-free assignment since the last reset; variables outside
+/// of that assignment are decided by their saved phase instead
+class TargetPhases {
+ private:
+  /// Polarity of each variable in the target
+  std::vector<bool> polarities;
+  /// Stamp of the last target containing each variable
+  std::vector<std::uint32_t> stamps;
+  /// Stamp of the current target; stamp 0 is never current
+  std::uint32_t stamp;
+  /// Number of variables in the current target
+  std::uint32_t num_assigned;
+
+ public:
+  /// Create an empty target
+  TargetPhases() : polarities(), stamps(), stamp(1), num_assigned(0) {}
+
+  /// Add variables up to `num_variables` outside of the target
+  void resize(std::size_t num_variables) {
+    polarities.resize(num_variables, false);
+    stamps.resize(num_variables, 0);
+  }
+
+  /// Number of variables in the target
+  std::uint32_t size() const noexcept { return num_assigned; }
+
+  /// Whether a variable is in the target
+  bool contains(clauses::Variable var) const noexcept {
+    return stamps[var] == stamp;
+  }
+
+  /// Remove all variables from the target
+  void reset() {
+    num_assigned = 0;
+    ++stamp;
+    if (stamp == 0) {
+      // Stamps wrapped around; forget all old targets
+      std::fill(stamps.begin(), stamps.end(), 0);
+      stamp = 1;
+    }
+  }
+
+  /// Replace the target by a conflict-free assignment
+  void assign(std::span<const clauses::Literal> literals) {
+    reset();
+    num_assigned = literals.size();
+    for (auto literal : literals) {
+      polarities[literal.var()] = literal.polarity();
+      stamps[literal.var()] = stamp;
+    }
+  }
+
+  /// Polarity to decide a variable with: its target phase if it is in the
+  /// target and `saved_phase` otherwise
+  bool phase(clauses::Variable var, bool saved_phase) const noexcept {
+    return contains(var) ? polarities[var] : saved_phase;
+  }
+};
+
+}  // namespace ns::solver::phases
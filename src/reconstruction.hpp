@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace ns::solver::reconstruction {
+
+/// Clauses removed by model-preserving simplifications (e.g. variable
+/// elimination) together with a witness literal each; extends a model of
+/// the simplified formula to a model of the original formula
+class ReconstructionStack {
+ private:
+  /// Literals of all pushed clauses; the witness is the first literal
+  std::vector<clauses::Literal> literals;
+  /// Start of each clause in `literals`
+  std::vector<std::uint32_t> clause_starts;
+
+ public:
+  ReconstructionStack() : literals(), clause_starts() {}
+
+  /// Number of pushed clauses
+  constexpr std::size_t size() const noexcept { return clause_starts.size(); }
+
+  /// Push a removed clause; `witness` must be contained in `clause` and is
+  /// made true if the clause is falsified when extending the model
+  void push(clauses::Literal witness,
+            std::span<const clauses::Literal> clause) {
+    clause_starts.push_back(literals.size());
+    literals.push_back(witness);
+    for (auto literal : clause) {
+      if (literal != witness) {
+        literals.push_back(literal);
+      }
+    }
+  }
+
+  /// Extend the model by processing the clauses in reverse push order;
+  /// falsified clauses are satisfied by flipping their witness
+  void extend(std::vector<clauses::VariableValue>& values) const {
+    auto end = static_cast<std::uint32_t>(literals.size());
+    for (auto i = clause_starts.size(); i > 0; --i) {
+      auto start = clause_starts[i - 1];
+      bool satisfied = false;
+      for (auto k = start; k < end; ++k) {
+        if (values[literals[k].var()] == literals[k].polarity()) {
+          satisfied = true;
+          break;
+        }
+      }
+      if (!satisfied) {
+        values[literals[start].var()] = literals[start].polarity();
+      }
+      end = start;
+    }
+  }
+};
+
+}  // namespace ns::solver::reconstruction
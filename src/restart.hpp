@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+
+#include "options.hpp"
 
 namespace ns::solver::restart {
 
@@ -19,4 +22,118 @@ inline double luby(double y, int x) {
   return std::pow(y, seq);
 }
 
+/// Restarts after a number of conflicts following the Luby sequence;
+/// restarts become rare as the intervals grow (reluctant doubling)
+class LubyRestart {
+ private:
+  /// Number of restarts so far
+  int num_restarts;
+  /// Number of conflicts since the last restart
+  std::uint64_t num_conflicts_since_restart;
+  /// Number of conflicts until the next restart
+  std::uint64_t restart_interval;
+
+ public:
+  LubyRestart()
+      : num_restarts(0),
+        num_conflicts_since_restart(0),
+        restart_interval(options::STABLE_RESTART_FIRST) {}
+
+  /// Record a conflict
+  constexpr void onConflict() noexcept { ++num_conflicts_since_restart; }
+
+  /// Whether to restart now
+  constexpr bool shouldRestart() const noexcept {
+    return num_conflicts_since_restart >= restart_interval;
+  }
+
+  /// Record a restart and compute the next interval
+  void onRestart() {
+    ++num_restarts;
+    num_conflicts_since_restart = 0;
+    restart_interval = static_cast<std::uint64_t>(
+        luby(options::STABLE_RESTART_INC, num_restarts) *
+        options::STABLE_RESTART_FIRST);
+  }
+};
+
+/// Exponential moving average with bias correction for early values
+class ExponentialMovingAverage {
+ private:
+  /// Smoothing factor; weight of the newest value
+  double alpha;
+  /// Biased moving average (starting at zero)
+  double biased;
+  /// `(1 - alpha)^n` after `n` updates; used to remove the initial bias
+  double exponent;
+
+ public:
+  /// Moving average with smoothing factor `alpha`
+  constexpr explicit ExponentialMovingAverage(double alpha)
+      : alpha(alpha), biased(0.0), exponent(1.0) {}
+
+  /// Add a new value
+  constexpr void update(double value) noexcept {
+    biased += alpha * (value - biased);
+    exponent *= 1.0 - alpha;
+  }
+
+  /// Current average; zero if no value has been added
+  constexpr double value() const noexcept {
+    return exponent < 1.0 ? biased / (1.0 - exponent) : 0.0;
+  }
+};
+
+/// Glucose-style dynamic restarts (Audemard, Simon 2012); restart if the
+/// recent learned clauses have a much higher literal block distance than
+/// the long-term average, but postpone restarts while the trail is
+/// unusually large, which indicates that a model may be close
+class GlucoseRestart {
+ private:
+  /// Average literal block distance of the recent learned clauses
+  ExponentialMovingAverage fast_lbd;
+  /// Long-term average literal block distance of learned clauses
+  ExponentialMovingAverage slow_lbd;
+  /// Average trail size at conflicts
+  ExponentialMovingAverage trail_size;
+  /// Number of conflicts in total
+  std::uint64_t num_conflicts;
+  /// Number of conflicts since the last restart (or blocked restart)
+  std::uint64_t num_conflicts_since_restart;
+
+ public:
+  GlucoseRestart()
+      : fast_lbd(options::RESTART_FAST_LBD_ALPHA),
+        slow_lbd(options::RESTART_SLOW_LBD_ALPHA),
+        trail_size(options::RESTART_TRAIL_ALPHA),
+        num_conflicts(0),
+        num_conflicts_since_restart(0) {}
+
+  /// Record a conflict with the literal block distance of the learned
+  /// clause and the trail size at the time of the conflict
+  void onConflict(std::uint32_t lbd, std::size_t trail) {
+    ++num_conflicts;
+    ++num_conflicts_since_restart;
+
+    // Block restart if trail is much larger than usual
+    if (num_conflicts > options::RESTART_BLOCK_CONFLICTS &&
+        trail > options::RESTART_BLOCK_MARGIN * trail_size.value()) {
+      num_conflicts_since_restart = 0;
+    }
+
+    trail_size.update(static_cast<double>(trail));
+    fast_lbd.update(lbd);
+    slow_lbd.update(lbd);
+  }
+
+  /// Whether to restart now
+  constexpr bool shouldRestart() const noexcept {
+    return num_conflicts_since_restart >= options::RESTART_MIN_CONFLICTS &&
+           fast_lbd.value() > options::RESTART_MARGIN * slow_lbd.value();
+  }
+
+  /// Record a restart
+  constexpr void onRestart() noexcept { num_conflicts_since_restart = 0; }
+};
+
 }  // namespace ns::solver::restart
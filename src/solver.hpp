@@ -1,20 +1,31 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <format>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <optional>
 #include <random>
+#include <span>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "clauses.hpp"
+#include "inprocessing.hpp"
 #include "options.hpp"
+#include "phases.hpp"
+#include "reconstruction.hpp"
 #include "restart.hpp"
+#include "vmtf.hpp"
+#include "vsids.hpp"
+#include "watches.hpp"
 
 namespace ns::solver {
 
@@ -33,6 +44,12 @@ enum class SolverExitCode : std::uint8_t {
   UNSAT = 20,
 };
 
+/// Decision heuristic of focused mode selected at compile time
+using FocusedHeuristic =
+    std::conditional_t<options::FOCUSED_DECISION_HEURISTIC ==
+                           options::DecisionHeuristic::VMTF,
+                       vmtf::Vmtf, vsids::Vsids>;
+
 /// Solver statistics
 struct SolverStatistics {
   /// Number of variables
@@ -45,14 +62,50 @@ struct SolverStatistics {
   std::uint64_t num_learned_clauses;
   /// Number of literals in learned clauses
   std::uint64_t num_literals_in_learned_clauses;
+  /// Number of clauses removed by subsumption
+  std::uint64_t num_subsumed_clauses;
+  /// Number of literals removed by self-subsuming resolution
+  std::uint64_t num_strengthened_clauses;
+  /// Number of variables replaced by an equivalent literal
+  std::uint64_t num_substituted_variables;
+  /// Number of variables removed by bounded variable elimination
+  std::uint64_t num_eliminated_variables;
+  /// Number of clauses removed by blocked clause elimination
+  std::uint64_t num_blocked_clauses;
+  /// Number of probed literals that implied a conflict
+  std::uint64_t num_failed_literals;
+  /// Number of binary clauses added by hyper-binary resolution
+  std::uint64_t num_hyper_binary_resolvents;
+  /// Number of learned clauses shortened by vivification
+  std::uint64_t num_vivified_clauses;
+  /// Number of learned literals replaced by block-level UIPs in shrinking
+  std::uint64_t num_shrunk_literals;
+  /// Number of learned literals removed via binary clauses of the asserting
+  /// literal
+  std::uint64_t num_binary_minimized_literals;
+  /// Number of removals of satisfied clauses at the top level
+  std::uint64_t num_simplifications;
+  /// Number of inprocessing passes run during search
+  std::uint64_t num_inprocessings;
   /// Number of search (re-)starts
   std::uint64_t num_restarts;
+  /// Number of decision levels kept on restarts
+  std::uint64_t num_reused_levels;
+  /// Number of switches between focused and stable mode
+  std::uint64_t num_mode_switches;
+  /// Number of resets of the saved phases
+  std::uint64_t num_rephases;
   /// Number of made decisions
   std::uint64_t num_decisions;
   /// Number of total conflicts
   std::uint64_t num_total_conflicts;
   /// Number of total propagations
   std::uint64_t num_propagations;
+  /// Deterministic measure of work: cache lines of watch and occurrence
+  /// lists scanned plus clauses accessed by propagation and simplification
+  std::uint64_t num_ticks;
+  /// Number of ticks spent in preprocessing and inprocessing passes
+  std::uint64_t num_simplification_ticks;
 
   SolverStatistics()
       : num_variables(0),
@@ -60,71 +113,252 @@ struct SolverStatistics {
         num_literals_in_clauses(0),
         num_learned_clauses(0),
         num_literals_in_learned_clauses(0),
+        num_subsumed_clauses(0),
+        num_strengthened_clauses(0),
+        num_substituted_variables(0),
+        num_eliminated_variables(0),
+        num_blocked_clauses(0),
+        num_failed_literals(0),
+        num_hyper_binary_resolvents(0),
+        num_vivified_clauses(0),
+        num_shrunk_literals(0),
+        num_binary_minimized_literals(0),
+        num_simplifications(0),
+        num_inprocessings(0),
         num_restarts(0),
+        num_reused_levels(0),
+        num_mode_switches(0),
+        num_rephases(0),
         num_decisions(0),
         num_total_conflicts(0),
-        num_propagations(0) {}
+        num_propagations(0),
+        num_ticks(0),
+        num_simplification_ticks(0) {}
 };
 
 /// SAT Solver object
 class Solver {
  private:
+  /// Used for analyzing conflicts in `analyzeConflict`
+  using VariableStatus = clauses::VariableStatus;
+
+  /// Phases that can replace the saved phases when rephasing
+  enum class Phase : std::uint8_t {
+    /// All variables false (the initial phase)
+    ORIGINAL = 0,
+    /// All variables true
+    INVERTED = 1,
+    /// Largest conflict-free assignment since the last rephasing
+    BEST = 2,
+    /// Random polarity per variable
+    RANDOM = 3,
+  };
+  /// Cyclic order of rephasings; every other one returns to the best phase
+  static constexpr std::array<Phase, 6> REPHASE_ORDER{
+      Phase::BEST,     Phase::ORIGINAL, Phase::BEST,
+      Phase::INVERTED, Phase::BEST,     Phase::RANDOM};
+
   // -- Representation of the SAT problem instance
-  /// All clauses
+  /// Arena storing all original and learned clauses
   clauses::Clauses clauses;
+  /// Arena the clauses are moved to by `collectGarbage`; swapped with
+  /// `clauses` afterwards so that no arena is allocated during search
+  clauses::Clauses relocated_clauses;
+  /// All original clauses
+  std::vector<clauses::ClauseRef> original_clauses;
 
   // -- Solver data structures
   /// All learned clauses
-  clauses::Clauses learned_clauses;
+  std::vector<clauses::ClauseRef> learned_clauses;
   /// Stack of all decisions currently made
   std::vector<clauses::Literal> trail;
   /// Where the decision levels in `trail` start
   std::vector<std::uint32_t> trail_separators;
   /// Points to the next literal in `trail` to propagate
   std::uint32_t trail_propagation_head;
-  /// Current variable assignments (variables can be unset, false, or true)
-  std::vector<clauses::VariableValue> variable_values;
-  /// Stores the preferred polarity of a variable (phase saving)
-  std::vector<bool> variable_polarity;
+  /// Current assignment of each literal; the only record of which
+  /// variables are assigned
+  clauses::LiteralValues literal_values;
+  /// Model of the last `solve` returning SAT, including eliminated variables
+  std::vector<clauses::VariableValue> model_values;
+  /// Polarities of the largest conflict-free assignment since the last
+  /// rephasing or mode switch; followed by decisions in stable mode
+  phases::TargetPhases target_phases;
+  /// Polarities of the largest conflict-free assignment since the last
+  /// rephasing
+  std::vector<bool> best_polarity;
   /// Stores metadata for all variables
   std::vector<clauses::VariableMetadata> variable_metadata;
-  /// Maintains which clauses watch each literal
-  std::vector<std::vector<clauses::Watch>> literals_watched_by;
-  /// Unset variables
-  std::vector<clauses::Variable> unset_variables;
+  /// Maintains which clauses watch each literal; may contain watches of
+  /// clauses detached since the last `flushWatches`
+  watches::WatchLists literals_watched_by;
+  /// Maintains which literals are implied by each literal via binary clauses
+  std::vector<std::vector<clauses::Implication>> literals_implied_by;
+  /// Literals of the binary reason clause last returned by `reasonLiterals`
+  std::array<clauses::Literal, 2> binary_reason_literals;
+  /// Whether each variable has been eliminated
+  std::vector<bool> variable_eliminated;
+  /// Clauses removed by eliminating variables, for extending the model
+  reconstruction::ReconstructionStack reconstruction_stack;
+
+  // -- Persistent buffers (avoid allocations per conflict)
+  /// Currently learned clause
+  std::vector<clauses::Literal> learned_clause;
+  /// Variables whose `seen` status was changed in this analysis
+  std::vector<clauses::Variable> seen_variables;
+  /// Stack of `(clause position, literal)` for the redundancy check
+  std::vector<std::pair<std::uint32_t, clauses::Literal>> redundancy_stack;
+  /// Learned clauses that may be deleted in a reduction or vivified
+  std::vector<clauses::ClauseRef> reduce_candidates;
+  /// Clauses connected to one of their literals (only while subsuming)
+  std::vector<std::vector<clauses::Occurrence>> connected_clauses;
+  /// Long original clauses containing each literal (only while eliminating)
+  std::vector<std::vector<clauses::ClauseRef>> literal_occurrences;
+  /// Literals of the clauses containing the variable to eliminate
+  std::vector<clauses::Literal> elimination_literals;
+  /// Start of each clause in `elimination_literals` (plus the end)
+  std::vector<std::uint32_t> elimination_clause_starts;
+  /// Literals of the current resolvent
+  std::vector<clauses::Literal> resolvent;
+  /// Marks the literals of a clause while resolving
+  std::vector<bool> literal_marks;
+  /// Decision heuristic ordering the unset variables in focused mode
+  FocusedHeuristic focused_heuristic;
+  /// Decision heuristic ordering the unset variables in stable mode
+  vsids::Vsids stable_heuristic;
 
   // -- Solver state
   /// Amount to change clause activity with
   double clause_activity_increment;
-  /// Maximum number of learned clauses allowed
+  /// Whether the search is in stable mode (otherwise in focused mode)
+  bool stable_mode;
+  /// Number of conflicts spent in each mode before switching
+  std::uint64_t mode_interval;
+  /// Total number of conflicts at which to switch the mode next
+  std::uint64_t next_mode_switch_conflicts;
+  /// Number of assigned variables of the best assignment
+  std::uint32_t best_num_assigned;
+  /// Number of conflicts between the last and the next rephasing
+  std::uint64_t rephase_interval;
+  /// Total number of conflicts at which to rephase next
+  std::uint64_t next_rephase_conflicts;
+  /// Generates random phases
+  std::mt19937 random_generator;
+  /// Schedule of subsumption during search
+  inprocessing::Schedule subsume_schedule;
+  /// Schedule of failed-literal probing and equivalent-literal
+  /// substitution during search
+  inprocessing::Schedule probe_schedule;
+  /// Schedule of learned clause vivification
+  inprocessing::Schedule vivify_schedule;
+  /// Number of top-level assignments when each literal was last probed
+  /// (only probed again after new units)
+  std::vector<std::int64_t> probe_num_assigned;
+  /// Parent of each variable assigned while probing in the binary
+  /// implication tree of the probed root; literals implied by a long
+  /// clause hang below the dominator of the clause
+  std::vector<clauses::Literal> probe_parents;
+  /// Hyper-binary resolvents `not dominator or implied` found by probing
+  std::vector<std::array<clauses::Literal, 2>> hyper_binary_resolvents;
+  /// Number of hyper-binary resolvents the current probing round may add
+  std::uint64_t num_hyper_binaries_allowed;
+  /// Literals of the clause being vivified
+  std::vector<clauses::Literal> vivify_literals;
+  /// Representative of the equivalence class of each literal; invalid for
+  /// literals without equivalent literals (only while substituting)
+  std::vector<clauses::Literal> representatives;
+  /// Decides when to restart in focused mode
+  restart::GlucoseRestart focused_restart;
+  /// Decides when to restart in stable mode
+  restart::LubyRestart stable_restart;
+  /// Number of conflicts between the last and the next reduction of the
+  /// learned clauses
+  std::uint64_t reduce_interval;
+  /// Total number of conflicts at which to reduce the learned clauses next
+  std::uint64_t next_reduce_conflicts;
+  /// Stamp of each decision level when computing literal block distances
+  std::vector<std::uint64_t> level_stamps;
+  /// Current stamp for `level_stamps`
+  std::uint64_t lbd_stamp;
+  /// Number of conflicts between progress log lines
   /// (is dynamically scaled, therefore `double`)
-  double max_learned_clauses;
-  /// By how much to adjust the learned clauses size on conflict
-  double learned_size_adjust_on_conflict;
-  /// Specifies after how many conflicts to adjust the learned clauses size
-  std::uint64_t learned_size_adjust_count;
-  /// Random generator
-  std::mt19937 random_gen;
+  double progress_log_interval;
+  /// Specifies after how many conflicts to log the progress next
+  std::uint64_t progress_log_count;
+  /// When to remove satisfied clauses at the top level next
+  inprocessing::SimplifySchedule simplify_schedule;
+  /// Number of literals assigned at decision level 0
+  std::int64_t num_top_level_assigned;
+  /// Whether the preprocessing passes of the first `solve` call have run
+  bool is_preprocessed;
+  /// Total number of conflicts at which `solve` stops the search
+  std::uint64_t conflict_limit;
   /// Solver statistics
   SolverStatistics stats;
 
  public:
   Solver()
       : clauses(),
+        relocated_clauses(),
+        original_clauses(),
         learned_clauses(),
         trail(),
         trail_separators(),
         trail_propagation_head(0),
-        variable_values(),
-        variable_polarity(),
+        literal_values(),
+        model_values(),
+        target_phases(),
+        best_polarity(),
         variable_metadata(),
         literals_watched_by(),
-        unset_variables(),
+        literals_implied_by(),
+        binary_reason_literals(),
+        variable_eliminated(),
+        reconstruction_stack(),
+        learned_clause(),
+        seen_variables(),
+        redundancy_stack(),
+        reduce_candidates(),
+        connected_clauses(),
+        literal_occurrences(),
+        elimination_literals(),
+        elimination_clause_starts(),
+        resolvent(),
+        literal_marks(),
+        focused_heuristic(),
+        stable_heuristic(options::STABLE_VARIABLE_ACTIVITY_DECAY),
         clause_activity_increment(1.0),
-        max_learned_clauses(0.0),
-        learned_size_adjust_on_conflict(100.0),
-        learned_size_adjust_count(100),
-        random_gen(42),
+        stable_mode(false),
+        mode_interval(options::MODE_FIRST),
+        next_mode_switch_conflicts(options::MODE_FIRST),
+        best_num_assigned(0),
+        rephase_interval(options::REPHASE_FIRST),
+        next_rephase_conflicts(options::REPHASE_FIRST),
+        random_generator(options::RANDOM_SEED),
+        subsume_schedule(options::SUBSUME_FIRST, options::SUBSUME_INCREMENT,
+                         options::SUBSUME_EFFORT, options::SUBSUME_MIN_TICKS),
+        probe_schedule(options::PROBE_FIRST, options::PROBE_INCREMENT,
+                       options::PROBE_EFFORT, options::PROBE_MIN_TICKS),
+        vivify_schedule(options::VIVIFY_FIRST, options::VIVIFY_INCREMENT,
+                        options::VIVIFY_EFFORT, options::VIVIFY_MIN_TICKS),
+        probe_num_assigned(),
+        probe_parents(),
+        hyper_binary_resolvents(),
+        num_hyper_binaries_allowed(0),
+        vivify_literals(),
+        representatives(),
+        focused_restart(),
+        stable_restart(),
+        reduce_interval(options::REDUCE_FIRST),
+        next_reduce_conflicts(options::REDUCE_FIRST),
+        level_stamps(),
+        lbd_stamp(0),
+        progress_log_interval(100.0),
+        progress_log_count(100),
+        simplify_schedule(),
+        num_top_level_assigned(0),
+        is_preprocessed(false),
+        conflict_limit(std::numeric_limits<std::uint64_t>::max()),
         stats() {}
 
   /// Number of variables
@@ -145,12 +379,19 @@ class Solver {
   /// Inits all data structures with the specified number of variables
   void createVariables(std::uint32_t num_variables) {
     stats.num_variables = num_variables;
-    variable_values.resize(numVariables());
-    variable_polarity.resize(numVariables(), false);
-    variable_metadata.resize(numVariables(), {{}, 0});
+    literal_values.resize(numVariables());
+    target_phases.resize(numVariables());
+    best_polarity.resize(numVariables(), false);
+    variable_metadata.resize(numVariables(),
+                             {{}, 0, 0, VariableStatus::UNSET, false});
     trail.reserve(numVariables() + 1);
-    unset_variables.reserve(numVariables());
+    focused_heuristic.createVariables(numVariables());
+    stable_heuristic.createVariables(numVariables());
     literals_watched_by.resize(numVariables() * 2);
+    literals_implied_by.resize(numVariables() * 2);
+    level_stamps.resize(numVariables() + 1, 0);
+    variable_eliminated.resize(numVariables(), false);
+    literal_marks.resize(numVariables() * 2, false);
   }
 
   /// Add clause; return whether clause was added (true)
@@ -168,12 +409,10 @@ class Solver {
     clauses::Literal last_literal;
     std::size_t num_final_elems = 0;
     for (auto curr_literal : copied_literals) {
-      auto var = curr_literal.var();
-      auto polarity = curr_literal.polarity();
-      assert(var < numVariables());
+      assert(curr_literal.var() < numVariables());
 
       // Clause already satisfied
-      if (variable_values[var] == polarity) {
+      if (literalTrue(curr_literal)) {
         return true;
       }
       // `not A or A` is always true
@@ -181,7 +420,7 @@ class Solver {
         return true;
       }
       // Literal false; no need to add
-      if (variable_values[var] == !polarity) {
+      if (literalFalse(curr_literal)) {
         continue;
       }
       // Duplicate literal, continue
@@ -205,34 +444,91 @@ class Solver {
 
     // Add fact for next propagation if singleton
     if (copied_literals.size() == 1) {
-      assignLiteral(copied_literals[0], {});
+      assignLiteral(copied_literals[0], {}, 0);
       return !propagate().valid();  // Check conflicts
     }
 
     // Add clause
-    attachClause(std::move(copied_literals), false);
+    if (copied_literals.size() == 2) {
+      attachBinaryClause(copied_literals[0], copied_literals[1], false);
+    } else {
+      attachClause(copied_literals, false);
+    }
     return true;
   }
 
   /// Contains the model if SAT
   const std::vector<clauses::VariableValue>& model() const noexcept {
-    return variable_values;
+    return model_values;
   }
 
-  /// Solves the loaded problem instance
-  SolverExitCode solve() {
+  /// Solves the loaded problem instance; returns `UNKNOWN` once
+  /// `max_conflicts` conflicts have been found in total, a later call
+  /// continues the search from there
+  SolverExitCode solve(std::uint64_t max_conflicts =
+                           std::numeric_limits<std::uint64_t>::max()) {
     // Check that clauses are non-empty
     if (numVariables() == 0 || numClauses() == 0) {
       return SolverExitCode::UNKNOWN;
     }
+    conflict_limit = max_conflicts;
+    if (!is_preprocessed) {
+      is_preprocessed = true;
+      if (!preprocess()) {
+        return SolverExitCode::UNSAT;
+      }
+    }
 
-    // Initial simplification
-    if (!simplify()) {
-      return SolverExitCode::UNSAT;
+    // Main loop
+    auto status = SolverExitCode::UNKNOWN;
+    while (status == SolverExitCode::UNKNOWN &&
+           stats.num_total_conflicts < conflict_limit) {
+      // Restart search whenever the restart policy of the current mode
+      // demands it or the mode switches
+      status = search();
+      // A search stopped by the conflict limit continues in the next call
+      if (status != SolverExitCode::UNKNOWN ||
+          stats.num_total_conflicts < conflict_limit) {
+        ++stats.num_restarts;
+      }
+    }
+    if (status == SolverExitCode::UNKNOWN) {
+      return status;
+    }
+
+    // Read off the model and assign eliminated variables
+    if (status == SolverExitCode::SAT) {
+      model_values.resize(numVariables());
+      for (clauses::Variable var = 0; var < numVariables(); ++var) {
+        model_values[var] = literal_values.value(var);
+      }
+      reconstruction_stack.extend(model_values);
     }
 
-    // Update maximum learned clauses size
-    max_learned_clauses = numClauses() * options::MAX_LEARNED_CLAUSES_FACTOR;
+    // Return solver exit status
+    return status;
+  }
+
+ private:
+  /// Initial simplification and preprocessing before the search; returns
+  /// false if the formula is found to be UNSAT
+  bool preprocess() {
+    // Each pass may spend ticks proportional to the size of the formula
+    if (!simplify()) {
+      return false;
+    }
+    if (!substituteEquivalentLiterals()) {
+      return false;
+    }
+    subsumeClauses(preprocessBudget());
+    eliminateBlockedClauses(preprocessBudget());
+    if (!eliminateVariables(preprocessBudget())) {
+      return false;
+    }
+    if (!probeLiterals(preprocessBudget())) {
+      return false;
+    }
+    stats.num_simplification_ticks = stats.num_ticks;
 
     // Print header for search statistics
     if constexpr (VERBOSE == VerbosityLevel::ALL) {
@@ -240,53 +536,31 @@ class Solver {
                    "]==============================\n"
                 << "| Conflicts |          ORIGINAL         |          LEARNED "
                    "        | Progress |\n"
-                << "|           |    Vars  Clauses Literals |    Limit  "
+                << "|           |    Vars  Clauses Literals |   Reduce  "
                    "Clauses Lit/Cl |          |\n"
                 << "==========================================================="
                    "===================="
                 << std::endl;
     }
 
-    // Main loop
     stats.num_restarts = 0;
-    auto status = SolverExitCode::UNKNOWN;
-    while (status == SolverExitCode::UNKNOWN) {
-      // Restart search after reaching a certain number of conflicts
-      // using the Luby restart sequence
-      double restart_base_value =
-          restart::luby(options::RESTART_INC, stats.num_restarts);
-      status = search(restart_base_value * options::RESTART_FIRST);
-      ++stats.num_restarts;
-    }
-
-    // Return solver exit status
-    return status;
+    return true;
   }
 
- private:
-  /// Used for analyzing conflicts in `analyzeConflict`
-  enum class VariableStatus : std::uint8_t {
-    /// Variable does not participate in conflict
-    UNSET = 0,
-    /// Variable is a source of conflict
-    IS_SOURCE = 1,
-    /// Variable causes a conflict but could be removed
-    REMOVABLE = 2,
-    /// Removing variable failed
-    REMOVAL_FAILED = 3,
-  };
-
-  /// Search for a model with the given number of allowed conflicts
-  SolverExitCode search(std::uint32_t allowed_num_of_conflicts) {
+  /// Search for a model until the restart policy demands a restart
+  SolverExitCode search() {
     // Number of levels to backtrack
     std::uint32_t backtrack_level = 0;
-    // Number of conflicts
-    std::uint32_t num_conflicts = 0;
-    // Currently learned clause
-    std::vector<clauses::Literal> learned_clause;
+    // Literal block distance of the currently learned clause
+    std::uint32_t lbd = 0;
 
-    // Search until finding model or reaching allowed number of conflicts
+    // Search until finding model or restarting
     while (true) {
+      // Stop at the conflict limit of `solve`
+      if (stats.num_total_conflicts >= conflict_limit) {
+        return SolverExitCode::UNKNOWN;
+      }
+
       // Propagate currently selected variables
       auto conflict = propagate();
 
@@ -294,66 +568,131 @@ class Solver {
       if (conflict.valid()) {
         // Found conflict
         ++stats.num_total_conflicts;
-        ++num_conflicts;
+
+        // After chronological backtracking, all conflicting literals may be
+        // assigned below the current decision level
+        auto [conflict_level, num_at_conflict_level] =
+            conflictLevel(conflict);
 
         // Conflict reached outer-most layer; UNSAT
-        if (decisionLevel() == 0) {
+        if (conflict_level == 0) {
           return SolverExitCode::UNSAT;
         }
 
+        // Single literal at the conflict level; it is implied one level
+        // below instead, no need to learn a clause
+        if (num_at_conflict_level == 1) {
+          assignMissedImplication(conflict, conflict_level);
+          continue;
+        }
+
+        // Analyze conflict at its level
+        revertTrail(conflict_level);
+
+        // Remember conflict-free part of trail
+        updateTargetPhases();
+
         // Analyze conflict
         learned_clause.clear();
-        backtrack_level = analyzeConflict(conflict, learned_clause);
-        revertTrail(backtrack_level);
+        backtrack_level = analyzeConflict(conflict, learned_clause, lbd);
+        if (stable_mode) {
+          stable_restart.onConflict();
+        } else {
+          focused_restart.onConflict(lbd, trail.size());
+        }
+
+        // Backtrack chronologically if the jump is long; the asserting
+        // literal is then assigned out of order at `backtrack_level`
+        if (decisionLevel() - backtrack_level >
+            options::CHRONO_BACKTRACK_THRESHOLD) {
+          revertTrail(decisionLevel() - 1);
+        } else {
+          revertTrail(backtrack_level);
+        }
 
         if (learned_clause.size() == 1) {
           // Found single-literal reason for conflict, propagate
-          assignLiteral(learned_clause[0], {});
+          assignLiteral(learned_clause[0], {}, 0);
+        } else if (learned_clause.size() == 2) {
+          // Learn binary clause, implied by the negated second literal
+          attachBinaryClause(learned_clause[0], learned_clause[1], true);
+          assignLiteral(learned_clause[0], ~learned_clause[1],
+                        backtrack_level);
         } else {
           // Else, learn clause and propagate first literal
           auto clause_ref = attachClause(learned_clause, true);
+          auto clause = clauseAt(clause_ref);
+          clause.setLbd(lbd);
+          clause.setUsed(lbd <= options::TIER2_LBD ? options::TIER2_USED : 1);
           increaseClauseActivity(clause_ref);
-          assignLiteral(learned_clause[0], clause_ref);
+          assignLiteral(learned_clause[0], clause_ref, backtrack_level);
         }
 
-        // Decay clause activities
+        // Decay variable and clause activities
+        if (stable_mode) {
+          stable_heuristic.decay();
+        } else {
+          focused_heuristic.decay();
+        }
         clause_activity_increment *= 1 / options::CLAUSE_ACTIVITY_DECAY;
 
-        // Update maximum number of learned clauses
-        --learned_size_adjust_count;
-        if (learned_size_adjust_count == 0) {
-          learned_size_adjust_on_conflict *=
-              options::MAX_LEARNED_ADJUST_INCREMENT;
-          learned_size_adjust_count =
-              static_cast<std::uint64_t>(learned_size_adjust_on_conflict);
-          max_learned_clauses *= options::MAX_LEARNED_CLAUSES_INCREMENT;
+        // Log progress
+        --progress_log_count;
+        if (progress_log_count == 0) {
+          progress_log_interval *= options::PROGRESS_LOG_INCREMENT;
+          progress_log_count =
+              static_cast<std::uint64_t>(progress_log_interval);
 
-          // Log progress
           if constexpr (VERBOSE == VerbosityLevel::ALL) {
-            auto free_variables =
-                stats.num_variables - (trail_separators.size() == 0
-                                           ? trail.size()
-                                           : trail_separators[0]);
+            auto free_variables = stats.num_variables -
+                                  stats.num_substituted_variables -
+                                  stats.num_eliminated_variables -
+                                  (trail_separators.size() == 0
+                                       ? trail.size()
+                                       : trail_separators[0]);
             auto literals_per_learned =
                 static_cast<double>(stats.num_literals_in_learned_clauses) /
                 static_cast<double>(stats.num_learned_clauses);
             auto progress_estimate_percent = progressEstimate() * 100.0;
-            std::cout << std::format(
-                             "| {:9d} | {:7d} {:8d} {:8d} | {:8d} {:8d} "
-                             "{:6.0f} | {:6.3f} % |",
-                             stats.num_total_conflicts, free_variables,
-                             stats.num_clauses, stats.num_literals_in_clauses,
-                             static_cast<std::uint64_t>(max_learned_clauses),
-                             stats.num_learned_clauses, literals_per_learned,
-                             progress_estimate_percent)
-                      << std::endl;
+            // Format directly into the stream without a temporary string
+            std::format_to(std::ostreambuf_iterator<char>(std::cout),
+                           "| {:9d} | {:7d} {:8d} {:8d} | {:8d} {:8d} "
+                           "{:6.0f} | {:6.3f} % |",
+                           stats.num_total_conflicts, free_variables,
+                           stats.num_clauses, stats.num_literals_in_clauses,
+                           next_reduce_conflicts, stats.num_learned_clauses,
+                           literals_per_learned, progress_estimate_percent);
+            std::cout << std::endl;
           }
         }
       } else {
         // No conflict
-        if (num_conflicts >= allowed_num_of_conflicts) {
-          // Reached bound on number of conflicts; revert complete trail
+        if (stats.num_total_conflicts >= next_mode_switch_conflicts) {
+          // Switch between focused and stable mode (implies restart)
           revertTrail(0);
+          switchMode();
+          return SolverExitCode::UNKNOWN;
+        }
+        if (stable_mode ? stable_restart.shouldRestart()
+                        : focused_restart.shouldRestart()) {
+          // Restart; revert the trail to the first decision that the
+          // heuristic would not pick again
+          // (the whole trail if a pass at decision level 0 is due)
+          std::uint32_t reused_level = 0;
+          bool is_reusable = !isTopLevelWorkDue();
+          if (stable_mode) {
+            stable_restart.onRestart();
+            if (is_reusable) {
+              reused_level = reusableTrailLevel(stable_heuristic);
+            }
+          } else {
+            focused_restart.onRestart();
+            if (is_reusable) {
+              reused_level = reusableTrailLevel(focused_heuristic);
+            }
+          }
+          stats.num_reused_levels += reused_level;
+          revertTrail(reused_level);
           return SolverExitCode::UNKNOWN;
         }
 
@@ -362,9 +701,23 @@ class Solver {
           return SolverExitCode::UNSAT;
         }
 
-        // Reduce the set of learned clauses if too many
-        if (learned_clauses.size() >= max_learned_clauses + trail.size()) {
+        // Run the inprocessing passes that are due
+        if (decisionLevel() == 0 && !inprocess()) {
+          return SolverExitCode::UNSAT;
+        }
+
+        // Reset the saved phases regularly
+        if (stats.num_total_conflicts >= next_rephase_conflicts) {
+          rephase();
+          rephase_interval += options::REPHASE_INCREMENT;
+          next_rephase_conflicts = stats.num_total_conflicts + rephase_interval;
+        }
+
+        // Reduce the set of learned clauses regularly
+        if (stats.num_total_conflicts >= next_reduce_conflicts) {
           pruneLearnedClauses();
+          reduce_interval += options::REDUCE_INCREMENT;
+          next_reduce_conflicts = stats.num_total_conflicts + reduce_interval;
         }
 
         // New variable decision
@@ -379,7 +732,7 @@ class Solver {
         trail_separators.push_back(trail.size());
 
         // Enqueue next branch literal
-        assignLiteral(*next_literal, {});
+        assignLiteral(*next_literal, {}, decisionLevel());
       }
     }
 
@@ -387,40 +740,49 @@ class Solver {
     return SolverExitCode::UNKNOWN;
   }
 
-  /// Analyze the given conflict; returns the backtrack level
-  /// and the learned clause
+  /// Analyze the given conflict; returns the backtrack level,
+  /// the learned clause, and its literal block distance
   std::uint32_t analyzeConflict(
-      clauses::ClauseRef conflict,
-      std::vector<clauses::Literal>& out_learned_clause) {
+      clauses::Conflict conflict,
+      std::vector<clauses::Literal>& out_learned_clause,
+      std::uint32_t& out_lbd) {
     // Leave room for the asserting literal
     out_learned_clause.emplace_back();
     std::int64_t index = trail.size() - 1;
     std::int64_t path_length = 0;
     clauses::Literal asserting_literal;
-    std::vector<VariableStatus> variable_seen(numVariables(),
-                                              VariableStatus::UNSET);
+    assert(seen_variables.empty());
 
     // Build learned conflict clause
+    auto reason = conflict.reason;
+    auto implied_literal = conflict.literal;
     do {
-      assert(conflict.valid());
-      auto& conflict_clause = clauseAt(conflict);
+      assert(reason.valid());
 
-      // Increase activity if learned clause
-      if (conflict.isLearned()) {
-        increaseClauseActivity(conflict);
+      // Increase activity and update usage if learned clause
+      if (reason.isClause() && clauseAt(reason.clauseRef()).isLearned()) {
+        increaseClauseActivity(reason.clauseRef());
+        updateLearnedClauseUsage(reason.clauseRef());
       }
 
+      auto conflict_clause = reasonLiterals(reason, implied_literal);
       auto start = static_cast<std::size_t>(asserting_literal.valid());
       for (std::size_t j = start; j < conflict_clause.size(); ++j) {
         auto conflict_literal = conflict_clause[j];
+        auto& metadata = variable_metadata[conflict_literal.var()];
 
         // Check unseen variables in clause
-        if (variable_seen[conflict_literal.var()] == VariableStatus::UNSET &&
-            variable_metadata[conflict_literal.var()].decision_level > 0) {
-          variable_seen[conflict_literal.var()] = VariableStatus::IS_SOURCE;
+        if (metadata.seen == VariableStatus::UNSET &&
+            metadata.decision_level > 0) {
+          metadata.seen = VariableStatus::IS_SOURCE;
+          seen_variables.push_back(conflict_literal.var());
+          if (stable_mode) {
+            stable_heuristic.bump(conflict_literal.var());
+          } else {
+            focused_heuristic.bump(conflict_literal.var());
+          }
 
-          if (variable_metadata[conflict_literal.var()].decision_level >=
-              decisionLevel()) {
+          if (metadata.decision_level >= decisionLevel()) {
             ++path_length;
           } else {
             out_learned_clause.push_back(conflict_literal);
@@ -428,11 +790,19 @@ class Solver {
         }
       }
 
-      // Select next clause to look at
-      while (variable_seen[trail[index--].var()] == VariableStatus::UNSET);
+      // Select next clause to look at; skip literals of lower levels left
+      // in the current level by chronological backtracking
+      while (
+          variable_metadata[trail[index].var()].seen == VariableStatus::UNSET ||
+          variable_metadata[trail[index].var()].decision_level <
+              decisionLevel()) {
+        --index;
+      }
+      --index;
       asserting_literal = trail[index + 1];
-      conflict = variable_metadata[asserting_literal.var()].reason_clause_idx;
-      variable_seen[asserting_literal.var()] = VariableStatus::UNSET;
+      reason = variable_metadata[asserting_literal.var()].reason;
+      implied_literal = asserting_literal;
+      variable_metadata[asserting_literal.var()].seen = VariableStatus::UNSET;
       --path_length;
 
     } while (path_length > 0);
@@ -442,15 +812,31 @@ class Solver {
     std::size_t i, j;
     for (i = j = 1; i < out_learned_clause.size(); ++i) {
       // Literal needed if it has top-level assignment or is not redundant
-      if (!variable_metadata[out_learned_clause[i].var()]
-               .reason_clause_idx.valid() ||
-          !isLiteralRedundantInConflictClause(variable_seen,
-                                              out_learned_clause[i])) {
+      if (!variable_metadata[out_learned_clause[i].var()].reason.valid() ||
+          !isLiteralRedundantInConflictClause(out_learned_clause[i])) {
         out_learned_clause[j] = out_learned_clause[i];
         ++j;
+      } else {
+        variable_metadata[out_learned_clause[i].var()].seen =
+            VariableStatus::REMOVABLE;
       }
     }
     out_learned_clause.resize(j);
+    auto size = out_learned_clause.size();
+    shrinkLearnedClause(out_learned_clause);
+    stats.num_shrunk_literals += size - out_learned_clause.size();
+    size = out_learned_clause.size();
+    minimizeWithBinaryImplications(out_learned_clause);
+    stats.num_binary_minimized_literals += size - out_learned_clause.size();
+
+    // Reset status of all touched variables
+    for (auto var : seen_variables) {
+      variable_metadata[var].seen = VariableStatus::UNSET;
+    }
+    seen_variables.clear();
+
+    // Number of distinct decision levels in the learned clause
+    out_lbd = computeLbd(out_learned_clause);
 
     // Find correct backtrack level
     std::uint32_t out_btlevel = 0;
@@ -474,36 +860,114 @@ class Solver {
     return out_btlevel;
   }
 
+  /// Highest decision level of the literals in a conflict and the number of
+  /// literals assigned at that level
+  std::pair<std::uint32_t, std::uint32_t> conflictLevel(
+      clauses::Conflict conflict) {
+    std::uint32_t conflict_level = 0;
+    std::uint32_t num_at_conflict_level = 0;
+    for (auto literal : reasonLiterals(conflict.reason, conflict.literal)) {
+      auto level = variable_metadata[literal.var()].decision_level;
+      if (level > conflict_level) {
+        conflict_level = level;
+        num_at_conflict_level = 1;
+      } else if (level == conflict_level) {
+        ++num_at_conflict_level;
+      }
+    }
+    return {conflict_level, num_at_conflict_level};
+  }
+
+  /// The conflicting clause has a single literal at the conflict level,
+  /// which the clause should have implied at the next-highest level of its
+  /// literals; backtrack below the conflict level and assign it
+  void assignMissedImplication(clauses::Conflict conflict,
+                               std::uint32_t conflict_level) {
+    if (conflict.reason.isBinary()) {
+      // Binary clause `conflict.literal or not implying_literal`
+      auto implying_literal = conflict.reason.implyingLiteral();
+      auto implied_level =
+          variable_metadata[conflict.literal.var()].decision_level;
+      auto implying_level =
+          variable_metadata[implying_literal.var()].decision_level;
+      revertTrail(conflict_level - 1);
+      if (implied_level == conflict_level) {
+        assignLiteral(conflict.literal, implying_literal, implying_level);
+      } else {
+        assignLiteral(~implying_literal, ~conflict.literal, implied_level);
+      }
+      return;
+    }
+
+    // Move the literal at the conflict level to position 0 and the
+    // highest of the remaining literals to position 1
+    auto clause_ref = conflict.reason.clauseRef();
+    auto clause = clauseAt(clause_ref);
+    std::array<clauses::Literal, 2> old_watched{clause[0], clause[1]};
+    for (std::size_t k = 1; k < clause.size(); ++k) {
+      if (variable_metadata[clause[k].var()].decision_level ==
+          conflict_level) {
+        std::swap(clause[0], clause[k]);
+        break;
+      }
+    }
+    for (std::size_t k = 2; k < clause.size(); ++k) {
+      if (variable_metadata[clause[k].var()].decision_level >
+          variable_metadata[clause[1].var()].decision_level) {
+        std::swap(clause[1], clause[k]);
+      }
+    }
+
+    // Watch the new positions 0 and 1
+    for (auto literal : old_watched) {
+      if (literal != clause[0] && literal != clause[1]) {
+        literals_watched_by.remove(~literal, {clause_ref, {}});
+      }
+    }
+    for (std::size_t k = 0; k < 2; ++k) {
+      if (clause[k] != old_watched[0] && clause[k] != old_watched[1]) {
+        literals_watched_by.push(~clause[k], {clause_ref, clause[1 - k]});
+      }
+    }
+
+    auto implied_level = variable_metadata[clause[1].var()].decision_level;
+    revertTrail(conflict_level - 1);
+    assignLiteral(clause[0], clause_ref, implied_level);
+  }
+
   /// Checks whether literal is redundant in the conflict
-  bool isLiteralRedundantInConflictClause(
-      std::vector<VariableStatus>& variable_seen, clauses::Literal literal) {
-    assert(variable_seen[literal.var()] == VariableStatus::UNSET ||
-           variable_seen[literal.var()] == VariableStatus::IS_SOURCE);
-    assert(variable_metadata[literal.var()].reason_clause_idx.valid());
-    auto* clause =
-        &clauseAt(variable_metadata[literal.var()].reason_clause_idx);
-    std::vector<std::pair<std::uint32_t, clauses::Literal>> stack;
+  bool isLiteralRedundantInConflictClause(clauses::Literal literal) {
+    assert(variable_metadata[literal.var()].seen == VariableStatus::UNSET ||
+           variable_metadata[literal.var()].seen == VariableStatus::IS_SOURCE);
+    assert(variable_metadata[literal.var()].reason.valid());
+    auto clause =
+        reasonLiterals(variable_metadata[literal.var()].reason, literal);
+    auto& stack = redundancy_stack;
+    stack.clear();
 
     for (std::uint32_t i = 1;; i++) {
-      if (i < clause->size()) {
+      if (i < clause.size()) {
         // Checking `literal`'s parent `l` (in reason graph)
-        auto parent = (*clause)[i];
+        auto parent = clause[i];
 
         // Variable at level 0 or previously removable
         if (variable_metadata[parent.var()].decision_level == 0 ||
-            variable_seen[parent.var()] == VariableStatus::IS_SOURCE ||
-            variable_seen[parent.var()] == VariableStatus::REMOVABLE) {
+            variable_metadata[parent.var()].seen == VariableStatus::IS_SOURCE ||
+            variable_metadata[parent.var()].seen == VariableStatus::REMOVABLE) {
           continue;
         }
 
         // Check variable can not be removed for some local reason
-        if (!variable_metadata[parent.var()].reason_clause_idx.valid() ||
-            variable_seen[parent.var()] == VariableStatus::REMOVAL_FAILED) {
+        if (!variable_metadata[parent.var()].reason.valid() ||
+            variable_metadata[parent.var()].seen ==
+                VariableStatus::REMOVAL_FAILED) {
           stack.emplace_back(0, literal);
           for (std::size_t i = 0; i < stack.size(); ++i) {
-            if (variable_seen[stack[i].second.var()] == VariableStatus::UNSET) {
-              variable_seen[stack[i].second.var()] =
+            if (variable_metadata[stack[i].second.var()].seen ==
+                VariableStatus::UNSET) {
+              variable_metadata[stack[i].second.var()].seen =
                   VariableStatus::REMOVAL_FAILED;
+              seen_variables.push_back(stack[i].second.var());
             }
           }
 
@@ -514,11 +978,13 @@ class Solver {
         stack.emplace_back(i, literal);
         i = 0;
         literal = parent;
-        clause = &clauseAt(variable_metadata[literal.var()].reason_clause_idx);
+        clause =
+            reasonLiterals(variable_metadata[literal.var()].reason, literal);
       } else {
         // Finished with current element `literal` and reason `clause`
-        if (variable_seen[literal.var()] == VariableStatus::UNSET) {
-          variable_seen[literal.var()] = VariableStatus::REMOVABLE;
+        if (variable_metadata[literal.var()].seen == VariableStatus::UNSET) {
+          variable_metadata[literal.var()].seen = VariableStatus::REMOVABLE;
+          seen_variables.push_back(literal.var());
         }
 
         // Terminate with success if stack is empty
@@ -529,7 +995,8 @@ class Solver {
         // Continue with top element on stack
         i = stack.back().first;
         literal = stack.back().second;
-        clause = &clauseAt(variable_metadata[literal.var()].reason_clause_idx);
+        clause =
+            reasonLiterals(variable_metadata[literal.var()].reason, literal);
         stack.pop_back();
       }
     }
@@ -537,45 +1004,204 @@ class Solver {
     return true;
   }
 
-  /// Prune learned clauses if too many
-  void pruneLearnedClauses() {
-    // Sort learned clauses by activity
-    std::vector<std::uint32_t> learned_clause_ind;
-    learned_clause_ind.reserve(learned_clauses.size());
-    for (std::uint32_t i = 0; i < learned_clauses.size(); ++i) {
-      if (!learned_clauses[{i, true}].empty()) {
-        learned_clause_ind.push_back(i);
-      }
-    }
-    std::sort(learned_clause_ind.begin(), learned_clause_ind.end(),
-              [this](std::uint32_t i, std::uint32_t j) {
-                return learned_clauses.activity({i, true}) <
-                       learned_clauses.activity({j, true});
+  /// Replace the literals of each lower decision level in the learned
+  /// clause by their block-level UIP, if one is reachable by resolving with
+  /// reasons that only contain literals of that level or literals already
+  /// in (or implied by) the clause (Fleury, Biere 2020)
+  void shrinkLearnedClause(std::vector<clauses::Literal>& learned) {
+    // Group the literals after the asserting literal by level
+    std::sort(learned.begin() + 1, learned.end(),
+              [this](clauses::Literal a, clauses::Literal b) {
+                return variable_metadata[a.var()].decision_level >
+                       variable_metadata[b.var()].decision_level;
               });
 
-    // Threshold for pruning
-    double median = learned_clauses.activity(
-        {learned_clause_ind[learned_clause_ind.size() / 2], true});
-    double threshold = clause_activity_increment / learned_clauses.size();
-    double pruneThresh = std::min(median, threshold);
+    std::size_t j = 1;
+    for (std::size_t begin = 1; begin < learned.size();) {
+      auto level = variable_metadata[learned[begin].var()].decision_level;
+      auto end = begin + 1;
+      while (end < learned.size() &&
+             variable_metadata[learned[end].var()].decision_level == level) {
+        ++end;
+      }
+
+      std::optional<clauses::Literal> uip;
+      if (end - begin > 1) {
+        uip = findBlockUip({learned.begin() + begin, learned.begin() + end},
+                           level);
+      }
+      if (uip.has_value()) {
+        // Replace the block by the negated UIP
+        for (auto i = begin; i < end; ++i) {
+          variable_metadata[learned[i].var()].seen = VariableStatus::REMOVABLE;
+        }
+        if (variable_metadata[uip->var()].seen == VariableStatus::UNSET) {
+          seen_variables.push_back(uip->var());
+        }
+        variable_metadata[uip->var()].seen = VariableStatus::IS_SOURCE;
+        learned[j] = ~*uip;
+        ++j;
+      } else {
+        for (auto i = begin; i < end; ++i) {
+          learned[j] = learned[i];
+          ++j;
+        }
+      }
+      begin = end;
+    }
+    learned.resize(j);
+  }
 
-    for (std::uint32_t i = 0; i < learned_clauses.size(); ++i) {
-      clauses::ClauseRef clause_ref(i, true);
-      auto& clause = learned_clauses[clause_ref];
+  /// Trail literal that every assignment of the block of learned literals at
+  /// `level` passes through, if resolving with reasons stays within the
+  /// level and the clause; the block's variables are marked `IS_SOURCE`
+  std::optional<clauses::Literal> findBlockUip(
+      std::span<const clauses::Literal> block, std::uint32_t level) {
+    auto num_open = block.size();
+    std::uint32_t index = 0;
+    for (auto literal : block) {
+      index = std::max(index, variable_metadata[literal.var()].trail_index);
+    }
 
-      // Skip deleted clauses
-      if (clause.empty()) {
+    while (true) {
+      auto literal = trail[index];
+      auto var = literal.var();
+      --index;
+      if (variable_metadata[var].decision_level != level ||
+          (variable_metadata[var].seen != VariableStatus::IS_SOURCE &&
+           variable_metadata[var].seen != VariableStatus::SHRINKABLE)) {
         continue;
       }
 
-      // Delete learned clauses if below `threshold` or smaller than median
-      // activity; do not delete binary or referenced clauses
-      if (clause.size() > 2 &&
-          learned_clauses.activity(clause_ref) < pruneThresh &&
-          !isLockedClause(clause_ref)) {
-        detachClause(clause_ref);
+      // Last open literal of the block is its UIP
+      --num_open;
+      if (num_open == 0) {
+        return literal;
+      }
+
+      // Resolve with the reason; decisions end the search unsuccessfully
+      auto reason = variable_metadata[var].reason;
+      if (!reason.valid()) {
+        return {};
+      }
+      auto reason_literals = reasonLiterals(reason, literal);
+      for (std::size_t k = 1; k < reason_literals.size(); ++k) {
+        auto reason_var = reason_literals[k].var();
+        auto reason_level = variable_metadata[reason_var].decision_level;
+        auto status = variable_metadata[reason_var].seen;
+        if (reason_level == 0 || status == VariableStatus::IS_SOURCE ||
+            status == VariableStatus::SHRINKABLE) {
+          continue;
+        }
+        if (reason_level == level) {
+          // Resolve this literal as well
+          if (status == VariableStatus::UNSET) {
+            seen_variables.push_back(reason_var);
+          }
+          variable_metadata[reason_var].seen = VariableStatus::SHRINKABLE;
+          ++num_open;
+        } else if (status != VariableStatus::REMOVABLE) {
+          // Literal of a lower level neither in nor implied by the clause
+          return {};
+        }
+      }
+    }
+  }
+
+  /// Remove the literals of the learned clause whose negation the asserting
+  /// literal implies via a binary clause (binary self-subsuming resolution)
+  void minimizeWithBinaryImplications(std::vector<clauses::Literal>& learned) {
+    bool found = false;
+    for (auto implication : literals_implied_by[~learned[0]]) {
+      auto var = implication.implied.var();
+      if (variable_metadata[var].seen == VariableStatus::IS_SOURCE &&
+          literalTrue(implication.implied)) {
+        variable_metadata[var].seen = VariableStatus::REMOVABLE;
+        found = true;
+      }
+    }
+    if (found) {
+      auto end = std::remove_if(
+          learned.begin() + 1, learned.end(), [this](clauses::Literal literal) {
+            return variable_metadata[literal.var()].seen !=
+                   VariableStatus::IS_SOURCE;
+          });
+      learned.erase(end, learned.end());
+    }
+  }
+
+  /// Literal block distance (number of distinct decision levels) of the
+  /// given assigned literals
+  std::uint32_t computeLbd(std::span<const clauses::Literal> literals) {
+    ++lbd_stamp;
+    std::uint32_t lbd = 0;
+    for (auto literal : literals) {
+      auto level = variable_metadata[literal.var()].decision_level;
+      if (level_stamps[level] != lbd_stamp) {
+        level_stamps[level] = lbd_stamp;
+        ++lbd;
+      }
+    }
+    return lbd;
+  }
+
+  /// Update the literal block distance and usage counter of a learned
+  /// clause used during conflict analysis
+  void updateLearnedClauseUsage(clauses::ClauseRef clause_ref) {
+    auto clause = clauseAt(clause_ref);
+    if (clause.lbd() > options::CORE_LBD) {
+      auto lbd = computeLbd({clause.begin(), clause.end()});
+      if (lbd < clause.lbd()) {
+        clause.setLbd(lbd);
+      }
+    }
+    clause.setUsed(clause.lbd() <= options::TIER2_LBD ? options::TIER2_USED
+                                                      : 1);
+  }
+
+  /// Prune learned clauses; core clauses are kept forever, tier-2 and
+  /// local clauses only while they are used, and the worst half of the
+  /// remaining local clauses is deleted
+  void pruneLearnedClauses() {
+    // Collect clauses that have not been used since the last reduction
+    auto& candidates = reduce_candidates;
+    candidates.clear();
+    for (auto clause_ref : learned_clauses) {
+      auto clause = clauseAt(clause_ref);
+      if (clause.lbd() <= options::CORE_LBD || isLockedClause(clause_ref)) {
+        continue;
+      }
+      if (clause.used() > 0) {
+        // Age usage; unused tier-2 clauses are demoted to local clauses
+        clause.setUsed(clause.used() - 1);
+        continue;
       }
+      candidates.push_back(clause_ref);
+    }
+
+    // Sort by literal block distance and activity; worst clauses first
+    std::sort(candidates.begin(), candidates.end(),
+              [this](clauses::ClauseRef a, clauses::ClauseRef b) {
+                auto clause_a = clauseAt(a);
+                auto clause_b = clauseAt(b);
+                if (clause_a.lbd() != clause_b.lbd()) {
+                  return clause_a.lbd() > clause_b.lbd();
+                }
+                return clause_a.activity() < clause_b.activity();
+              });
+
+    // Delete the worst clauses
+    auto num_to_delete = static_cast<std::size_t>(
+        static_cast<double>(candidates.size()) * options::REDUCE_FRACTION);
+    for (std::size_t i = 0; i < num_to_delete; ++i) {
+      detachClause(candidates[i]);
     }
+
+    // Remove deleted clauses from the list of learned clauses
+    std::erase_if(learned_clauses, [this](clauses::ClauseRef clause_ref) {
+      return clauseAt(clause_ref).isDeleted();
+    });
+    checkGarbage();
   }
 
   /// Progress estimate
@@ -594,82 +1220,209 @@ class Solver {
     return progress / numVariables();
   }
 
+  /// Highest decision level whose decisions would all be picked again
+  /// after a restart; they are preferred over the next decision candidate
+  /// (Van der Tak, Ramos, Heule 2011)
+  template <typename Heuristic>
+  std::uint32_t reusableTrailLevel(Heuristic& heuristic) {
+    auto next_var = heuristic.next(literal_values);
+    if (!next_var.has_value()) {
+      return decisionLevel();
+    }
+    // Candidate is still unassigned; return it to the heuristic
+    heuristic.unassign(*next_var);
+
+    std::uint32_t level = 0;
+    while (level < decisionLevel() &&
+           heuristic.prefers(trail[trail_separators[level]].var(),
+                             *next_var)) {
+      ++level;
+    }
+    return level;
+  }
+
+  /// Switch between focused and stable mode at decision level 0; each mode
+  /// keeps its own heuristic state, which only tracks the variables
+  /// unassigned while the mode was active
+  void switchMode() {
+    assert(decisionLevel() == 0);
+    stable_mode = !stable_mode;
+    ++stats.num_mode_switches;
+
+    // Both modes run equally long; the length grows after each pair
+    if (!stable_mode) {
+      mode_interval = static_cast<std::uint64_t>(
+          static_cast<double>(mode_interval) * options::MODE_INCREMENT);
+    }
+    next_mode_switch_conflicts = stats.num_total_conflicts + mode_interval;
+    target_phases.reset();
+
+    // Catch up on variables unassigned during the other mode
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      if (literal_values.value(var).isUnset() && !variable_eliminated[var]) {
+        if (stable_mode) {
+          stable_heuristic.unassign(var);
+        } else {
+          focused_heuristic.unassign(var);
+        }
+      }
+    }
+  }
+
   /// Pick next literal to branch on
   std::optional<clauses::Literal> pickBranchLiteral() {
-    // Random decision
-    while (!unset_variables.empty()) {
-      // Select random unset variable
-      std::uniform_int_distribution<std::size_t> dist(
-          0, unset_variables.size() - 1);
-      auto idx = dist(random_gen);
-      auto var = unset_variables[idx];
-      unset_variables[idx] = unset_variables.back();
-      unset_variables.pop_back();
+    // Unset variable preferred by the decision heuristic
+    auto var = stable_mode ? stable_heuristic.next(literal_values)
+                           : focused_heuristic.next(literal_values);
+    if (!var.has_value()) {
+      return {};
+    }
+    // Follow the target phase in stable mode if the variable is in the
+    // target and the saved phase otherwise
+    auto polarity = variable_metadata[*var].phase;
+    if (stable_mode) {
+      polarity = target_phases.phase(*var, polarity);
+    }
+    return {{*var, polarity}};
+  }
 
-      // Check whether variable is unset
-      if (variable_values[var].isUnset()) {
-        return {{var, variable_polarity[var]}};
+  /// Store the assignment before the current decision level as target and
+  /// best assignment if it is larger; called on conflicts, when the
+  /// assignment before the current level is known to be conflict-free
+  void updateTargetPhases() {
+    assert(decisionLevel() > 0);
+    auto num_assigned = trail_separators.back();
+    if (stable_mode && num_assigned > target_phases.size()) {
+      target_phases.assign({trail.data(), num_assigned});
+    }
+    if (num_assigned > best_num_assigned) {
+      best_num_assigned = num_assigned;
+      for (std::uint32_t i = 0; i < num_assigned; ++i) {
+        best_polarity[trail[i].var()] = trail[i].polarity();
+      }
+    }
+  }
+
+  /// Replace the saved phases with the next phase of `REPHASE_ORDER` and
+  /// empty the target, so that both modes follow them; escapes plateaus
+  /// where phase saving keeps repeating the same partial assignment
+  void rephase() {
+    auto phase = REPHASE_ORDER[stats.num_rephases % REPHASE_ORDER.size()];
+    ++stats.num_rephases;
+
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      bool polarity = false;
+      switch (phase) {
+        case Phase::ORIGINAL:
+          polarity = false;
+          break;
+        case Phase::INVERTED:
+          polarity = true;
+          break;
+        case Phase::BEST:
+          polarity = best_polarity[var];
+          break;
+        case Phase::RANDOM:
+          polarity = random_generator() & 1;
+          break;
       }
+      variable_metadata[var].phase = polarity;
     }
 
-    return {};
+    // Search for new target and best assignments
+    target_phases.reset();
+    best_num_assigned = 0;
   }
 
   /// Accesses an original or learned clause
-  std::vector<clauses::Literal>& clauseAt(clauses::ClauseRef clause_ref) {
-    if (clause_ref.isLearned()) {
-      return learned_clauses[clause_ref];
-    }
+  clauses::Clause clauseAt(clauses::ClauseRef clause_ref) {
     return clauses[clause_ref];
   }
 
+  /// Literals of the reason clause that implied `implied_literal`, which is
+  /// the first literal; binary reasons are only valid until the next call
+  std::span<const clauses::Literal> reasonLiterals(
+      clauses::Reason reason, clauses::Literal implied_literal) {
+    assert(reason.valid());
+    if (reason.isBinary()) {
+      binary_reason_literals = {implied_literal, ~reason.implyingLiteral()};
+      return binary_reason_literals;
+    }
+    auto clause = clauseAt(reason.clauseRef());
+    return {clause.begin(), clause.end()};
+  }
+
   /// Whether literal is satisfied
   bool literalTrue(clauses::Literal literal) const noexcept {
-    return variable_values[literal.var()] == literal.polarity();
+    return literal_values.isTrue(literal);
   }
 
   /// Whether literal is not satisfied
   bool literalFalse(clauses::Literal literal) const noexcept {
-    return variable_values[literal.var()] == !literal.polarity();
+    return literal_values.isFalse(literal);
   }
 
   /// Check that clause is not the reason of some propagation
   bool isLockedClause(clauses::ClauseRef clause_ref) {
-    auto& clause = clauseAt(clause_ref);
+    auto clause = clauseAt(clause_ref);
     return literalTrue(clause[0]) &&
-           variable_metadata[clause[0].var()].reason_clause_idx.valid() &&
-           variable_metadata[clause[0].var()].reason_clause_idx == clause_ref;
+           variable_metadata[clause[0].var()].reason == clause_ref;
   }
 
   /// Increases the clause activity of a learned clause
   void increaseClauseActivity(clauses::ClauseRef clause_ref) {
-    assert(clause_ref.isLearned());
-    auto& activity = learned_clauses.activity(clause_ref);
-    activity += clause_activity_increment;
+    auto clause = clauseAt(clause_ref);
+    assert(clause.isLearned());
+    clause.setActivity(clause.activity() + clause_activity_increment);
 
     // Rescale if `activity` exceeds `1e20`
-    if (activity > 1e20) {
-      for (std::uint32_t i = 0; i < learned_clauses.size(); ++i) {
-        learned_clauses.activity({i, true}) *= 1e-20;
+    if (clause.activity() > 1e20) {
+      for (auto learned_clause_ref : learned_clauses) {
+        auto learned_clause = clauseAt(learned_clause_ref);
+        learned_clause.setActivity(learned_clause.activity() * 1e-20);
       }
       clause_activity_increment *= 1e-20;
     }
   }
 
   /// Propagate all facts in `trail` starting from `trail_propagation_head`;
-  /// returns conflicting clause index or `UNDEF_CLAUSE` if none
-  clauses::ClauseRef propagate() {
+  /// returns the conflict or an invalid conflict if none
+  clauses::Conflict propagate() {
     // Current conflict
-    clauses::ClauseRef conflict;
+    clauses::Conflict conflict;
 
     // Propagates all enqueued facts
     while (trail_propagation_head < trail.size()) {
       // Get literal and watches to propagate
       auto literal_to_propagate = trail[trail_propagation_head];
       ++trail_propagation_head;
-      auto& watches = literals_watched_by[literal_to_propagate];
       ++stats.num_propagations;
+      simplify_schedule.onPropagation();
+
+      // Level of the propagated literal; lower than the current level for
+      // literals left out of order by chronological backtracking
+      auto propagation_level =
+          variable_metadata[literal_to_propagate.var()].decision_level;
+
+      // Binary clauses imply literals without accessing the clause arena
+      stats.num_ticks += cacheLines<clauses::Implication>(
+          literals_implied_by[literal_to_propagate].size());
+      for (auto implication : literals_implied_by[literal_to_propagate]) {
+        if (literalTrue(implication.implied)) {
+          continue;
+        }
+        if (literalFalse(implication.implied)) {
+          // Found conflict
+          trail_propagation_head = trail.size();
+          return {literal_to_propagate, implication.implied};
+        }
+        assignLiteral(implication.implied, literal_to_propagate,
+                      propagation_level);
+      }
 
+      // Check all watches of longer clauses
+      auto watches = literals_watched_by[literal_to_propagate];
+      stats.num_ticks += cacheLines<clauses::Watch>(watches.size());
       // Check all watches
       std::size_t i = 0;
       std::size_t j = 0;
@@ -685,7 +1438,13 @@ class Solver {
 
         // Make sure the false literal is at position 2
         auto clause_ref = watches[i].clause_ref;
-        auto& clause = clauseAt(clause_ref);
+        auto clause = clauseAt(clause_ref);
+        ++stats.num_ticks;
+        if (clause.isDeleted()) {
+          // Drop watch of a clause detached since the last `flushWatches`
+          ++i;
+          continue;
+        }
         auto not_literal = ~literal_to_propagate;
         if (clause[0] == not_literal) {
           clause[0] = clause[1];
@@ -709,7 +1468,10 @@ class Solver {
           if (!literalFalse(clause[k])) {
             clause[1] = clause[k];
             clause[k] = not_literal;
-            literals_watched_by[~clause[1]].push_back(new_watch);
+            if (literals_watched_by.push(~clause[1], new_watch)) {
+              // Growing may have moved the watches of `literal_to_propagate`
+              watches = literals_watched_by[literal_to_propagate];
+            }
             found_new_watch = true;
             break;
           }
@@ -723,7 +1485,7 @@ class Solver {
         ++j;
         if (literalFalse(first_literal)) {
           // Found conflict
-          conflict = clause_ref;
+          conflict = {clause_ref, first_literal};
           trail_propagation_head = trail.size();
           while (i < watches.size()) {
             watches[j] = watches[i];
@@ -731,160 +1493,251 @@ class Solver {
             ++j;
           }
         } else {
-          // Found fact
-          assignLiteral(first_literal, clause_ref);
+          // Found fact; implied at the highest level of the false literals
+          auto implication_level = propagation_level;
+          if (implication_level < decisionLevel()) {
+            for (std::size_t k = 2; k < clause.size(); ++k) {
+              implication_level = std::max(
+                  implication_level,
+                  variable_metadata[clause[k].var()].decision_level);
+            }
+          }
+          assignLiteral(first_literal, clause_ref, implication_level);
         }
       }
 
       // Resize `watches`
-      watches.resize(j);
+      literals_watched_by.shrink(literal_to_propagate, j);
     }
 
     // Return current conflict
     return conflict;
   }
 
+  /// Number of cache lines occupied by `size` elements of type `T`; at
+  /// least one tick per list access
+  template <typename T>
+  static constexpr std::uint64_t cacheLines(std::size_t size) noexcept {
+    return 1 + (size * sizeof(T)) / options::CACHE_LINE_BYTES;
+  }
+
+  /// Number of ticks spent in search (excluding simplification passes)
+  constexpr std::uint64_t searchTicks() const noexcept {
+    return stats.num_ticks - stats.num_simplification_ticks;
+  }
+
   /// Returns the current decision level
   constexpr std::uint32_t decisionLevel() const noexcept {
     return trail_separators.size();
   }
 
-  /// Reverts the assignment trail until the given decision level
-  void revertTrail(std::uint32_t level) {
+  /// Reverts the assignment trail until the given decision level; literals
+  /// of lower levels placed above it by chronological backtracking stay
+  /// assigned and are propagated again
+  void revertTrail(std::uint32_t level, bool save_phases = true) {
     // Reverting to `level` only necessary if current level higher
     if (decisionLevel() > level) {
-      for (std::int64_t c = trail.size() - 1; c >= trail_separators[level];
-           --c) {
+      std::size_t num_kept = trail_separators[level];
+      for (std::size_t c = trail_separators[level]; c < trail.size(); ++c) {
         // Literal to revert
         auto literal_to_revert = trail[c];
         auto variable = literal_to_revert.var();
         bool polarity = literal_to_revert.polarity();
 
+        // Keep literals assigned out of order
+        if (variable_metadata[variable].decision_level <= level) {
+          trail[num_kept] = literal_to_revert;
+          variable_metadata[variable].trail_index = num_kept;
+          ++num_kept;
+          continue;
+        }
+
         // Unset assignment and save preferred polarity
-        variable_values[variable] = {};
-        variable_polarity[variable] = polarity;
-        unset_variables.push_back(variable);
+        literal_values.unassign(literal_to_revert);
+        if (save_phases) {
+          variable_metadata[variable].phase = polarity;
+        }
+        if (stable_mode) {
+          stable_heuristic.unassign(variable);
+        } else {
+          focused_heuristic.unassign(variable);
+        }
       }
 
       // Shrink `trail` and `trail_separators` to specified `level`
       trail_propagation_head = trail_separators[level];
-      trail.resize(trail_propagation_head);
+      trail.resize(num_kept);
       trail_separators.resize(level);
     }
   }
 
-  /// Assigns the given literal (must be unset previously)
-  void assignLiteral(clauses::Literal literal,
-                     clauses::ClauseRef reason_clause_idx) {
+  /// Assigns the given literal (must be unset previously) at `level`, the
+  /// highest level of the literals of its reason
+  void assignLiteral(clauses::Literal literal, clauses::Reason reason,
+                     std::uint32_t level) {
     // Assigned literal must be unset previously
     auto var = literal.var();
-    assert(variable_values[var].isUnset());
+    assert(literal_values.value(var).isUnset());
+    assert(level <= decisionLevel());
 
     // Assign literal
-    variable_values[var] = literal.polarity();
-    variable_metadata[var].decision_level = decisionLevel();
-    variable_metadata[var].reason_clause_idx = reason_clause_idx;
+    literal_values.assign(literal);
+    variable_metadata[var].decision_level = level;
+    variable_metadata[var].trail_index = trail.size();
+    variable_metadata[var].reason = reason;
     trail.push_back(literal);
-  }
-
-  /// Removes a watch from `literals_watched_by`
-  void removeWatch(std::vector<clauses::Watch>& watches,
-                   clauses::Watch watch_to_remove) {
-    // Find watch
-    std::size_t i = 0;
-    while (i < watches.size() && watches[i] != watch_to_remove) {
-      ++i;
+    if (level == 0) {
+      ++num_top_level_assigned;
     }
+  }
 
-    // Assert that watch found
-    assert(i < watches.size());
-
-    // Move remaining watches and pop back
-    while (i < watches.size() - 1) {
-      watches[i] = watches[i + 1];
-      ++i;
+  /// Attaches a binary clause by creating implications in both directions
+  void attachBinaryClause(clauses::Literal first_literal,
+                          clauses::Literal second_literal, bool is_learned) {
+    if (is_learned) {
+      ++stats.num_learned_clauses;
+      stats.num_literals_in_learned_clauses += 2;
+    } else {
+      ++stats.num_clauses;
+      stats.num_literals_in_clauses += 2;
     }
-    watches.pop_back();
+    literals_implied_by[~first_literal].emplace_back(second_literal,
+                                                     is_learned);
+    literals_implied_by[~second_literal].emplace_back(first_literal,
+                                                      is_learned);
   }
 
-  /// Attaches a clause by creating watches
-  clauses::ClauseRef attachClause(std::vector<clauses::Literal> literals,
+  /// Attaches a clause with at least three literals by creating watches
+  clauses::ClauseRef attachClause(const std::vector<clauses::Literal>& literals,
                                   bool is_learned) {
     // Add clause
+    assert(literals.size() > 2);
     auto first_literal = literals[0];
     auto second_literal = literals[1];
-    clauses::ClauseRef clause_ref;
+    auto clause_ref = clauses.addClause(literals, is_learned);
     if (is_learned) {
       ++stats.num_learned_clauses;
       stats.num_literals_in_learned_clauses += literals.size();
-      clause_ref = learned_clauses.addClause(std::move(literals), true);
+      learned_clauses.push_back(clause_ref);
     } else {
       ++stats.num_clauses;
       stats.num_literals_in_clauses += literals.size();
-      clause_ref = clauses.addClause(std::move(literals), false);
+      original_clauses.push_back(clause_ref);
     }
 
     // Keep two watches per clause
-    literals_watched_by[~first_literal].emplace_back(clause_ref,
-                                                     second_literal);
-    literals_watched_by[~second_literal].emplace_back(clause_ref,
-                                                      first_literal);
+    literals_watched_by.push(~first_literal, {clause_ref, second_literal});
+    literals_watched_by.push(~second_literal, {clause_ref, first_literal});
     return clause_ref;
   }
 
-  /// Removes a clause by removing watches and clearing literals
+  /// Removes a clause by deleting it from the arena; its watches are purged
+  /// in one sweep by `flushWatches`, and the caller removes `clause_ref`
+  /// from `original_clauses` or `learned_clauses`
   void detachClause(clauses::ClauseRef clause_ref) {
-    auto& clause = clauseAt(clause_ref);
-    removeWatch(literals_watched_by[~clause[0]], {clause_ref, clause[1]});
-    removeWatch(literals_watched_by[~clause[1]], {clause_ref, clause[0]});
+    auto clause = clauseAt(clause_ref);
+    literals_watched_by.markStale(~clause[0]);
+    literals_watched_by.markStale(~clause[1]);
     if (isLockedClause(clause_ref)) {
-      variable_metadata[clause.front().var()].reason_clause_idx = {};
+      variable_metadata[clause[0].var()].reason = {};
     }
 
-    if (clause_ref.isLearned()) {
+    if (clause.isLearned()) {
       --stats.num_learned_clauses;
       stats.num_literals_in_learned_clauses -= clause.size();
-      learned_clauses.removeClause(clause_ref);
     } else {
       --stats.num_clauses;
       stats.num_literals_in_clauses -= clause.size();
-      clauses.removeClause(clause_ref);
     }
+    clauses.removeClause(clause_ref);
   }
 
-  /// Remove the satisfied clauses in the given container
-  void removeSatisfiedClauses(clauses::Clauses& clauses_to_check,
-                              bool is_learned) {
-    for (std::uint32_t clause_idx = 0; clause_idx < clauses_to_check.size();
-         ++clause_idx) {
-      clauses::ClauseRef clause_ref(clause_idx, is_learned);
-      auto& clause = clauses_to_check[clause_ref];
+  /// Remove the satisfied clauses in the given list of clauses
+  void removeSatisfiedClauses(std::vector<clauses::ClauseRef>& clause_refs) {
+    std::size_t j = 0;
+    for (auto clause_ref : clause_refs) {
+      auto clause = clauseAt(clause_ref);
 
-      // Skip deleted clauses
-      if (clause.empty()) {
+      if (isClauseSatisfied(clause)) {
+        // Remove clause
+        detachClause(clause_ref);
         continue;
       }
 
-      if (isClauseSatisfied(clause)) {
-        // Remove clause
+      // Trim clause; first two literals cannot be true since otherwise
+      // `isClauseSatisfied()` and cannot be false by invariant
+      assert(clause.size() > 1);
+      assert(literal_values.isUnset(clause[0]));
+      assert(literal_values.isUnset(clause[1]));
+      std::uint32_t new_size = clause.size();
+      for (std::uint32_t i = 2; i < new_size; ++i) {
+        if (literalFalse(clause[i])) {
+          clause[i] = clause[new_size - 1];
+          --new_size;
+          --i;
+        }
+      }
+
+      // Clauses trimmed to two literals become binary implications
+      if (new_size == 2) {
+        auto first_literal = clause[0];
+        auto second_literal = clause[1];
+        bool is_learned = clause.isLearned();
         detachClause(clause_ref);
-      } else {
-        // Trim clause; first two literals cannot be true since otherwise
-        // `isClauseSatisfied()` and cannot be false by invariant
-        assert(clause.size() > 1);
-        assert(variable_values[clause[0].var()].isUnset());
-        assert(variable_values[clause[1].var()].isUnset());
-        for (std::size_t i = 2; i < clause.size(); ++i) {
-          if (variable_values[clause[i].var()].isFalse()) {
-            clause[i] = clause.back();
-            clause.pop_back();
-            --i;
+        attachBinaryClause(first_literal, second_literal, is_learned);
+        continue;
+      }
+
+      clauses.shrinkClause(clause_ref, new_size);
+      clause_refs[j] = clause_ref;
+      ++j;
+    }
+    clause_refs.resize(j);
+  }
+
+  /// Remove the satisfied binary clauses; only valid at decision level 0
+  /// after propagation, where every binary clause with an assigned literal
+  /// is satisfied
+  void removeSatisfiedBinaryClauses() {
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      for (bool polarity : {false, true}) {
+        clauses::Literal literal(var, polarity);
+        auto& implications = literals_implied_by[literal];
+        std::size_t j = 0;
+        for (auto implication : implications) {
+          // Implication is clause `(not literal or implication.implied)`
+          if (literal_values.value(var).isUnset() &&
+              literal_values.isUnset(implication.implied)) {
+            implications[j] = implication;
+            ++j;
+            continue;
+          }
+
+          // Each clause is stored twice; count it in one direction only
+          if (~literal < implication.implied) {
+            if (implication.is_learned) {
+              --stats.num_learned_clauses;
+              stats.num_literals_in_learned_clauses -= 2;
+            } else {
+              --stats.num_clauses;
+              stats.num_literals_in_clauses -= 2;
+            }
           }
         }
+        implications.resize(j);
       }
     }
   }
 
+  /// Remove all satisfied clauses and false literals; only valid at
+  /// decision level 0 after propagation
+  void removeAllSatisfiedClauses() {
+    removeSatisfiedBinaryClauses();
+    removeSatisfiedClauses(learned_clauses);
+    removeSatisfiedClauses(original_clauses);
+    checkGarbage();
+  }
+
   /// Simplify by removing satisfied clauses
   bool simplify() {
     // Only top-level simplifications
@@ -895,25 +1748,1156 @@ class Solver {
       return false;
     }
 
-    // Remove satisfied clauses
-    removeSatisfiedClauses(learned_clauses, true);
-    removeSatisfiedClauses(clauses, false);
+    assert(static_cast<std::int64_t>(trail.size()) == num_top_level_assigned);
 
-    // Update unset variables
-    unset_variables.clear();
-    for (clauses::Variable var = 0; var < variable_values.size(); ++var) {
-      if (variable_values[var].isUnset()) {
-        unset_variables.push_back(var);
-      }
+    // Only simplify if there are new top-level assignments and enough
+    // propagations have been made since the last simplification
+    if (!simplify_schedule.isDue(num_top_level_assigned)) {
+      return true;
     }
-    std::shuffle(unset_variables.begin(), unset_variables.end(), random_gen);
+
+    // Remove satisfied clauses
+    removeAllSatisfiedClauses();
+    ++stats.num_simplifications;
+
+    // Next simplification after propagating about as many literals as
+    // there are in all clauses
+    simplify_schedule.onRun(num_top_level_assigned,
+                            stats.num_literals_in_clauses +
+                                stats.num_literals_in_learned_clauses);
 
     // Problem instance still satisfiable
     return true;
   }
 
+  /// Tick budget of a preprocessing pass
+  std::uint64_t preprocessBudget() const noexcept {
+    return std::max(options::PREPROCESS_MIN_TICKS,
+                    static_cast<std::uint64_t>(
+                        options::PREPROCESS_EFFORT *
+                        static_cast<double>(stats.num_literals_in_clauses)));
+  }
+
+  /// Run the inprocessing passes that are due; each spends a fraction of
+  /// the search ticks since its last run, so that simplification stays a
+  /// bounded share of the work on formulas of any shape; returns false if
+  /// the formula is found UNSAT
+  bool inprocess() {
+    assert(decisionLevel() == 0);
+    auto start_ticks = stats.num_ticks;
+    bool satisfiable = true;
+
+    // Remove subsumed clauses
+    if (subsume_schedule.isDue(stats.num_total_conflicts)) {
+      subsumeClauses(subsume_schedule.budget(searchTicks()));
+      subsume_schedule.onRun(stats.num_total_conflicts, searchTicks());
+      ++stats.num_inprocessings;
+    }
+
+    // Probe for failed literals and substitute the equivalent literals
+    // found by the new binary clauses
+    if (satisfiable && probe_schedule.isDue(stats.num_total_conflicts)) {
+      satisfiable = probeLiterals(probe_schedule.budget(searchTicks())) &&
+                    substituteEquivalentLiterals();
+      probe_schedule.onRun(stats.num_total_conflicts, searchTicks());
+      ++stats.num_inprocessings;
+    }
+
+    // Vivify learned clauses
+    if (satisfiable && vivify_schedule.isDue(stats.num_total_conflicts)) {
+      satisfiable = vivifyLearnedClauses(vivify_schedule.budget(searchTicks()));
+      vivify_schedule.onRun(stats.num_total_conflicts, searchTicks());
+      ++stats.num_inprocessings;
+    }
+
+    stats.num_simplification_ticks += stats.num_ticks - start_ticks;
+    return satisfiable;
+  }
+
+  /// Whether `simplify` or `inprocess` has work to do; both only run at
+  /// decision level 0, which a restart reusing the trail rarely reaches
+  bool isTopLevelWorkDue() const {
+    if (simplify_schedule.isDue(num_top_level_assigned)) {
+      return true;
+    }
+    auto num_conflicts = stats.num_total_conflicts;
+    return subsume_schedule.isDue(num_conflicts) ||
+           probe_schedule.isDue(num_conflicts) ||
+           vivify_schedule.isDue(num_conflicts);
+  }
+
+  /// Remove clauses subsumed by other clauses and strengthen clauses by
+  /// self-subsuming resolution (Een, Biere 2005); long original and learned
+  /// clauses are checked in order of increasing size against the binary
+  /// clauses and the smaller clauses checked before, which are connected to
+  /// the occurrence list of their least occurring literal; stops after
+  /// spending `tick_budget` ticks
+  void subsumeClauses(std::uint64_t tick_budget) {
+    assert(decisionLevel() == 0);
+    removeAllSatisfiedClauses();
+
+    std::vector<clauses::ClauseRef> candidates;
+    for (auto clause_refs : {&original_clauses, &learned_clauses}) {
+      for (auto clause_ref : *clause_refs) {
+        if (clauseAt(clause_ref).size() <= options::SUBSUME_CLAUSE_SIZE_LIMIT) {
+          candidates.push_back(clause_ref);
+        }
+      }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [this](clauses::ClauseRef a, clauses::ClauseRef b) {
+                       return clauseAt(a).size() < clauseAt(b).size();
+                     });
+
+    connected_clauses.resize(numVariables() * 2);
+    auto end_ticks = stats.num_ticks + tick_budget;
+    for (auto clause_ref : candidates) {
+      if (stats.num_ticks >= end_ticks) {
+        break;
+      }
+      clauses::Literal removable;
+      if (isClauseSubsumed(clause_ref, removable)) {
+        detachClause(clause_ref);
+        ++stats.num_subsumed_clauses;
+        continue;
+      }
+      if (removable.valid()) {
+        ++stats.num_strengthened_clauses;
+        clause_ref = strengthenClause(clause_ref, removable);
+        if (!clause_ref.valid()) {
+          // Became binary clause
+          continue;
+        }
+      }
+
+      // Connect to the literal with the fewest connected clauses
+      auto clause = clauseAt(clause_ref);
+      auto connect_literal = clause[0];
+      for (auto literal : clause) {
+        if (connected_clauses[literal].size() <
+            connected_clauses[connect_literal].size()) {
+          connect_literal = literal;
+        }
+      }
+      connected_clauses[connect_literal].emplace_back(clause_ref,
+                                                      clause.signature());
+    }
+    connected_clauses.clear();
+
+    for (auto clause_refs : {&original_clauses, &learned_clauses}) {
+      std::erase_if(*clause_refs, [this](clauses::ClauseRef clause_ref) {
+        return clauseAt(clause_ref).isDeleted();
+      });
+    }
+    checkGarbage();
+  }
+
+  /// Whether a binary or connected clause subsumes the given clause;
+  /// otherwise, `out_removable` is set to a literal of the clause that can
+  /// be removed by self-subsuming resolution, if any; learned clauses only
+  /// subsume learned clauses
+  bool isClauseSubsumed(clauses::ClauseRef clause_ref,
+                        clauses::Literal& out_removable) {
+    auto clause = clauseAt(clause_ref);
+    auto signature = clause.signature();
+    for (auto literal : clause) {
+      literal_marks[literal] = true;
+    }
+
+    bool subsumed = false;
+    for (auto literal : clause) {
+      // Binary clauses `literal or implied`
+      stats.num_ticks += cacheLines<clauses::Implication>(
+          literals_implied_by[~literal].size() +
+          literals_implied_by[literal].size());
+      for (auto implication : literals_implied_by[~literal]) {
+        if (literal_marks[implication.implied] &&
+            (clause.isLearned() || !implication.is_learned)) {
+          subsumed = true;
+        } else if (literal_marks[~implication.implied]) {
+          out_removable = ~implication.implied;
+        }
+      }
+      // Binary clauses `not literal or implied`
+      for (auto implication : literals_implied_by[literal]) {
+        if (literal_marks[implication.implied]) {
+          out_removable = literal;
+        }
+      }
+
+      // Connected clauses with `literal` or its negation
+      for (auto connect_literal : {literal, ~literal}) {
+        stats.num_ticks += cacheLines<clauses::Occurrence>(
+            connected_clauses[connect_literal].size());
+        for (auto occurrence : connected_clauses[connect_literal]) {
+          if ((occurrence.signature & ~signature) != 0) {
+            continue;
+          }
+
+          // Subset of the clause except for at most one negated literal
+          auto other_clause = clauseAt(occurrence.clause_ref);
+          ++stats.num_ticks;
+          clauses::Literal negated;
+          bool is_subset = true;
+          for (auto other_literal : other_clause) {
+            if (literal_marks[other_literal]) {
+              continue;
+            }
+            if (!negated.valid() && literal_marks[~other_literal]) {
+              negated = other_literal;
+              continue;
+            }
+            is_subset = false;
+            break;
+          }
+          if (!is_subset) {
+            continue;
+          }
+          if (negated.valid()) {
+            out_removable = ~negated;
+          } else if (clause.isLearned() || !other_clause.isLearned()) {
+            subsumed = true;
+          }
+        }
+      }
+      if (subsumed) {
+        break;
+      }
+    }
+
+    for (auto literal : clause) {
+      literal_marks[literal] = false;
+    }
+    return subsumed;
+  }
+
+  /// Replace the unassigned long clause by a copy without `literal`; returns
+  /// the new clause or an invalid reference if the copy is a binary clause
+  clauses::ClauseRef strengthenClause(clauses::ClauseRef clause_ref,
+                                      clauses::Literal literal) {
+    resolvent.clear();
+    for (auto clause_literal : clauseAt(clause_ref)) {
+      if (clause_literal != literal) {
+        resolvent.push_back(clause_literal);
+      }
+    }
+    return replaceClause(clause_ref, resolvent);
+  }
+
+  /// Replace the long clause by a clause of at least two unassigned
+  /// `literals`, keeping the metadata of learned clauses; returns the new
+  /// clause or an invalid reference if the new clause is binary
+  clauses::ClauseRef replaceClause(
+      clauses::ClauseRef clause_ref,
+      const std::vector<clauses::Literal>& literals) {
+    assert(literals.size() > 1);
+    auto clause = clauseAt(clause_ref);
+    auto is_learned = clause.isLearned();
+    auto lbd = clause.lbd();
+    auto used = clause.used();
+    auto activity = clause.activity();
+    detachClause(clause_ref);
+
+    if (literals.size() == 2) {
+      attachBinaryClause(literals[0], literals[1], is_learned);
+      return {};
+    }
+    auto new_clause_ref = attachClause(literals, is_learned);
+    if (is_learned) {
+      auto new_clause = clauseAt(new_clause_ref);
+      new_clause.setLbd(std::min<std::uint32_t>(lbd, literals.size()));
+      new_clause.setUsed(used);
+      new_clause.setActivity(activity);
+    }
+    return new_clause_ref;
+  }
+
+  /// Failed-literal probing on the roots of the binary implication graph
+  /// (literals occurring only negated in binary clauses), spending a
+  /// budget of `tick_budget` ticks; a root whose propagation fails is
+  /// learned negated as unit, otherwise the literals it implies through
+  /// long clauses yield hyper-binary resolvents (at most
+  /// `PROBE_MAX_HYPER_BINARIES` per round); returns false if the formula is
+  /// found UNSAT
+  bool probeLiterals(std::uint64_t tick_budget) {
+    assert(decisionLevel() == 0);
+    if (propagate().valid()) {
+      return false;
+    }
+    probe_num_assigned.resize(numVariables() * 2, -1);
+    probe_parents.resize(numVariables());
+    num_hyper_binaries_allowed = options::PROBE_MAX_HYPER_BINARIES;
+    auto end_ticks = stats.num_ticks + tick_budget;
+    for (std::uint32_t i = 0;
+         i < numVariables() * 2 && stats.num_ticks < end_ticks; ++i) {
+      if (!probeLiteral({i / 2, i % 2 == 1})) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Probe `literal` if it is an unassigned root not probed since the last
+  /// new unit; returns false if the formula is found UNSAT
+  bool probeLiteral(clauses::Literal literal) {
+    if (!literal_values.isUnset(literal) ||
+        literals_implied_by[literal].empty() ||
+        !literals_implied_by[~literal].empty() ||
+        probe_num_assigned[literal] ==
+            static_cast<std::int64_t>(trail.size())) {
+      return true;
+    }
+    probe_num_assigned[literal] = trail.size();
+
+    // Propagate the root at decision level 1 without touching the phases
+    trail_separators.push_back(trail.size());
+    assignLiteral(literal, {}, 1);
+    auto conflict = propagate();
+    hyper_binary_resolvents.clear();
+    if (!conflict.valid()) {
+      findHyperBinaryResolvents();
+    }
+    revertTrail(0, false);
+
+    if (conflict.valid()) {
+      // Failed literal
+      ++stats.num_failed_literals;
+      assignLiteral(~literal, {}, 0);
+      return !propagate().valid();
+    }
+    for (auto [dominator, implied] : hyper_binary_resolvents) {
+      attachBinaryClause(~dominator, implied, true);
+      ++stats.num_hyper_binary_resolvents;
+    }
+    return true;
+  }
+
+  /// Hyper-binary resolution (Bacchus 2002; Heule, Jarvisalo, Biere 2013)
+  /// on the literals assigned by probing a root at decision level 1: a
+  /// literal implied by a long clause is also implied by the dominator of
+  /// the other literals of the clause in the binary implication tree, which
+  /// yields the resolvent `not dominator or implied`; resolvents that are
+  /// already binary clauses are skipped
+  void findHyperBinaryResolvents() {
+    assert(decisionLevel() == 1);
+    for (auto i = trail_separators[0]; i < trail.size(); ++i) {
+      auto implied = trail[i];
+      auto reason = variable_metadata[implied.var()].reason;
+      if (!reason.valid()) {
+        // The probed root
+        probe_parents[implied.var()] = {};
+        continue;
+      }
+      if (!reason.isClause()) {
+        probe_parents[implied.var()] = reason.implyingLiteral();
+        continue;
+      }
+
+      // Dominator of the negated false literals of decision level 1
+      auto clause = clauseAt(reason.clauseRef());
+      clauses::Literal dominator;
+      for (auto literal : clause) {
+        if (literal == implied ||
+            variable_metadata[literal.var()].decision_level == 0) {
+          continue;
+        }
+        dominator =
+            dominator.valid() ? probeDominator(dominator, ~literal) : ~literal;
+      }
+      probe_parents[implied.var()] = dominator;
+
+      if (num_hyper_binaries_allowed == 0) {
+        continue;
+      }
+      const auto& implications = literals_implied_by[dominator];
+      stats.num_ticks += cacheLines<clauses::Implication>(implications.size());
+      if (std::none_of(implications.begin(), implications.end(),
+                       [implied](clauses::Implication implication) {
+                         return implication.implied == implied;
+                       })) {
+        hyper_binary_resolvents.push_back({dominator, implied});
+        --num_hyper_binaries_allowed;
+      }
+    }
+  }
+
+  /// Closest common ancestor of two literals in the binary implication
+  /// tree built while probing
+  clauses::Literal probeDominator(clauses::Literal first,
+                                  clauses::Literal second) {
+    for (auto literal = first; literal.valid();
+         literal = probe_parents[literal.var()]) {
+      literal_marks[literal] = true;
+    }
+    auto dominator = second;
+    while (!literal_marks[dominator]) {
+      dominator = probe_parents[dominator.var()];
+    }
+    for (auto literal = first; literal.valid();
+         literal = probe_parents[literal.var()]) {
+      literal_marks[literal] = false;
+    }
+    return dominator;
+  }
+
+  /// Vivify the learned clauses of the core and tier 2 that have not been
+  /// vivified yet with a budget of `tick_budget` ticks; returns false if the
+  /// formula is found UNSAT
+  bool vivifyLearnedClauses(std::uint64_t tick_budget) {
+    assert(decisionLevel() == 0);
+    if (propagate().valid()) {
+      return false;
+    }
+    removeAllSatisfiedClauses();
+    auto end_ticks = stats.num_ticks + tick_budget;
+
+    // Clauses of low LBD first, then in arena order; sorted in place since
+    // `std::stable_sort` allocates a buffer
+    auto& candidates = reduce_candidates;
+    candidates.clear();
+    for (auto clause_ref : learned_clauses) {
+      auto clause = clauseAt(clause_ref);
+      if (!clause.isVivified() && clause.lbd() <= options::TIER2_LBD) {
+        candidates.push_back(clause_ref);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [this](clauses::ClauseRef a, clauses::ClauseRef b) {
+                auto lbd_a = clauseAt(a).lbd();
+                auto lbd_b = clauseAt(b).lbd();
+                return lbd_a != lbd_b ? lbd_a < lbd_b
+                                      : a.offset() < b.offset();
+              });
+
+    for (auto clause_ref : candidates) {
+      if (stats.num_ticks >= end_ticks) {
+        break;
+      }
+      if (!vivifyClause(clause_ref)) {
+        return false;
+      }
+    }
+
+    std::erase_if(learned_clauses, [this](clauses::ClauseRef clause_ref) {
+      return clauseAt(clause_ref).isDeleted();
+    });
+    checkGarbage();
+    return true;
+  }
+
+  /// Vivification (Piette, Hamadi, Sais 2008): assign the negated literals
+  /// of the clause one by one at new decision levels and propagate; the
+  /// clause is shortened to the assigned literals on a conflict or if a
+  /// literal becomes true, and literals that become false are dropped;
+  /// returns false if the formula is found UNSAT
+  bool vivifyClause(clauses::ClauseRef clause_ref) {
+    auto clause = clauseAt(clause_ref);
+    clause.markVivified();
+    // Units found by vivifying earlier clauses may satisfy the clause
+    if (isClauseSatisfied(clause)) {
+      return true;
+    }
+    // Propagation reorders the literals of the clause
+    vivify_literals.assign(clause.begin(), clause.end());
+
+    resolvent.clear();
+    for (auto literal : vivify_literals) {
+      if (literalFalse(literal)) {
+        continue;
+      }
+      resolvent.push_back(literal);
+      if (literalTrue(literal)) {
+        break;
+      }
+      trail_separators.push_back(trail.size());
+      assignLiteral(~literal, {}, decisionLevel());
+      if (propagate().valid()) {
+        break;
+      }
+    }
+    revertTrail(0, false);
+
+    if (resolvent.size() == vivify_literals.size()) {
+      return true;
+    }
+    ++stats.num_vivified_clauses;
+    if (resolvent.size() == 1) {
+      detachClause(clause_ref);
+      assignLiteral(resolvent[0], {}, 0);
+      return !propagate().valid();
+    }
+    auto new_clause_ref = replaceClause(clause_ref, resolvent);
+    if (new_clause_ref.valid()) {
+      clauseAt(new_clause_ref).markVivified();
+    }
+    return true;
+  }
+
+  /// Equivalent literal substitution: the literals of a strongly connected
+  /// component of the binary implication graph are equivalent and are
+  /// replaced in all clauses by the literal of the smallest variable; the
+  /// substituted variables are removed and their equivalences saved for
+  /// model reconstruction; returns false if the formula is found UNSAT
+  bool substituteEquivalentLiterals() {
+    assert(decisionLevel() == 0);
+    removeAllSatisfiedClauses();
+    if (!findEquivalentLiterals()) {
+      return false;
+    }
+
+    // Remove substituted variables; `literal` is true iff its
+    // representative is
+    auto num_substituted = stats.num_substituted_variables;
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      clauses::Literal literal(var, true);
+      auto representative = representatives[literal];
+      if (!representative.valid() || representative == literal) {
+        continue;
+      }
+      variable_eliminated[var] = true;
+      focused_heuristic.remove(var);
+      stable_heuristic.remove(var);
+      ++stats.num_substituted_variables;
+      std::array<clauses::Literal, 2> equivalence = {literal, ~representative};
+      reconstruction_stack.push(literal, equivalence);
+      equivalence = {~literal, representative};
+      reconstruction_stack.push(~literal, equivalence);
+    }
+    if (stats.num_substituted_variables == num_substituted) {
+      representatives.clear();
+      return true;
+    }
+
+    // Rewrite binary clauses containing substituted literals
+    std::vector<std::pair<clauses::Literal, clauses::Implication>>
+        binary_clauses;
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      for (bool polarity : {false, true}) {
+        clauses::Literal literal(var, polarity);
+        std::erase_if(
+            literals_implied_by[literal],
+            [this, literal, &binary_clauses](clauses::Implication implication) {
+              // Implication is clause `(not literal or implication.implied)`
+              if (substitute(~literal) == ~literal &&
+                  substitute(implication.implied) == implication.implied) {
+                return false;
+              }
+
+              // Each clause is stored twice; collect it in one direction
+              if (~literal < implication.implied) {
+                binary_clauses.emplace_back(~literal, implication);
+                if (implication.is_learned) {
+                  --stats.num_learned_clauses;
+                  stats.num_literals_in_learned_clauses -= 2;
+                } else {
+                  --stats.num_clauses;
+                  stats.num_literals_in_clauses -= 2;
+                }
+              }
+              return true;
+            });
+      }
+    }
+    for (auto [first_literal, implication] : binary_clauses) {
+      resolvent.assign({first_literal, implication.implied});
+      if (!substituteLiterals(resolvent)) {
+        continue;
+      }
+      if (resolvent.size() == 1) {
+        if (!assignSubstitutedUnit(resolvent[0])) {
+          return false;
+        }
+      } else {
+        attachBinaryClause(resolvent[0], resolvent[1], implication.is_learned);
+      }
+    }
+
+    // Rewrite long clauses containing substituted literals; rewritten
+    // clauses are appended to the lists
+    for (auto clause_refs : {&original_clauses, &learned_clauses}) {
+      auto num_clauses = clause_refs->size();
+      for (std::size_t i = 0; i < num_clauses; ++i) {
+        auto clause_ref = (*clause_refs)[i];
+        auto clause = clauseAt(clause_ref);
+        if (clause.isDeleted() ||
+            std::all_of(clause.begin(), clause.end(),
+                        [this](clauses::Literal literal) {
+                          return substitute(literal) == literal;
+                        })) {
+          continue;
+        }
+        resolvent.assign(clause.begin(), clause.end());
+        if (!substituteLiterals(resolvent)) {
+          detachClause(clause_ref);
+        } else if (resolvent.size() == 1) {
+          detachClause(clause_ref);
+          if (!assignSubstitutedUnit(resolvent[0])) {
+            return false;
+          }
+        } else {
+          replaceClause(clause_ref, resolvent);
+        }
+      }
+      std::erase_if(*clause_refs, [this](clauses::ClauseRef clause_ref) {
+        return clauseAt(clause_ref).isDeleted();
+      });
+    }
+    representatives.clear();
+
+    // Propagate units from collapsed clauses
+    if (propagate().valid()) {
+      return false;
+    }
+    removeAllSatisfiedClauses();
+    return true;
+  }
+
+  /// Representative of `literal` while substituting
+  clauses::Literal substitute(clauses::Literal literal) const {
+    auto representative = representatives[literal];
+    return representative.valid() ? representative : literal;
+  }
+
+  /// Substitute the literals of a clause and remove duplicate literals;
+  /// returns false if the clause becomes a tautology
+  bool substituteLiterals(std::vector<clauses::Literal>& literals) {
+    std::size_t j = 0;
+    bool is_tautology = false;
+    for (auto literal : literals) {
+      literal = substitute(literal);
+      if (literal_marks[~literal]) {
+        is_tautology = true;
+      } else if (!literal_marks[literal]) {
+        literal_marks[literal] = true;
+        literals[j] = literal;
+        ++j;
+      }
+    }
+    literals.resize(j);
+    for (auto literal : literals) {
+      literal_marks[literal] = false;
+    }
+    return !is_tautology;
+  }
+
+  /// Assign a clause collapsed to `literal` by substitution at the top
+  /// level; returns false if `literal` is false
+  bool assignSubstitutedUnit(clauses::Literal literal) {
+    if (literalFalse(literal)) {
+      return false;
+    }
+    if (!literalTrue(literal)) {
+      assignLiteral(literal, {}, 0);
+    }
+    return true;
+  }
+
+  /// Compute `representatives` with Tarjan's algorithm over the binary
+  /// implication graph of the unassigned literals; returns false if a
+  /// literal is equivalent to its negation
+  bool findEquivalentLiterals() {
+    constexpr auto UNVISITED = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> visit_index(numVariables() * 2, UNVISITED);
+    std::vector<std::uint32_t> lowest_index(numVariables() * 2);
+    // Literals of the unfinished components; marked in `literal_marks`
+    std::vector<clauses::Literal> component_stack;
+    // Depth-first search path with the next implication to follow
+    std::vector<std::pair<clauses::Literal, std::uint32_t>> path;
+    std::uint32_t next_index = 0;
+    representatives.assign(numVariables() * 2, {});
+
+    auto visit = [&](clauses::Literal literal) {
+      visit_index[literal] = next_index;
+      lowest_index[literal] = next_index;
+      ++next_index;
+      component_stack.push_back(literal);
+      literal_marks[literal] = true;
+      path.emplace_back(literal, 0);
+    };
+
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      for (bool polarity : {false, true}) {
+        clauses::Literal root(var, polarity);
+        if (visit_index[root] != UNVISITED ||
+            !literal_values.value(var).isUnset() || variable_eliminated[var]) {
+          continue;
+        }
+        visit(root);
+        while (!path.empty()) {
+          auto [literal, next] = path.back();
+          const auto& implications = literals_implied_by[literal];
+          if (next < implications.size()) {
+            ++path.back().second;
+            auto implied = implications[next].implied;
+            assert(literal_values.isUnset(implied));
+            if (visit_index[implied] == UNVISITED) {
+              visit(implied);
+            } else if (literal_marks[implied]) {
+              lowest_index[literal] =
+                  std::min(lowest_index[literal], visit_index[implied]);
+            }
+            continue;
+          }
+
+          path.pop_back();
+          if (!path.empty()) {
+            auto parent = path.back().first;
+            lowest_index[parent] =
+                std::min(lowest_index[parent], lowest_index[literal]);
+          }
+          if (lowest_index[literal] != visit_index[literal]) {
+            continue;
+          }
+
+          // Pop finished component from the top of the stack; the negated
+          // component has the negated representative
+          auto begin = std::prev(std::find(component_stack.rbegin(),
+                                           component_stack.rend(), literal)
+                                     .base());
+          auto representative = *std::min_element(begin, component_stack.end());
+          for (auto it = begin; it != component_stack.end(); ++it) {
+            literal_marks[*it] = false;
+            representatives[*it] = representative;
+          }
+          component_stack.erase(begin, component_stack.end());
+        }
+      }
+    }
+
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      clauses::Literal literal(var, true);
+      if (representatives[literal].valid() &&
+          representatives[literal] == representatives[~literal]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Bounded variable elimination (Een, Biere 2005) on the original clauses
+  /// before search; a variable is replaced by all resolvents of its clauses
+  /// if they do not outnumber the removed clauses; stops after spending
+  /// `tick_budget` ticks; returns false if UNSAT
+  bool eliminateVariables(std::uint64_t tick_budget) {
+    assert(decisionLevel() == 0);
+    assert(learned_clauses.empty());
+
+    buildOccurrenceLists();
+    auto end_ticks = stats.num_ticks + tick_budget;
+
+    // Try cheap variables (few occurrences) first
+    std::vector<clauses::Variable> candidates;
+    for (std::uint32_t round = 0; round < options::ELIM_ROUNDS; ++round) {
+      candidates.clear();
+      for (clauses::Variable var = 0; var < numVariables(); ++var) {
+        if (literal_values.value(var).isUnset() && !variable_eliminated[var]) {
+          candidates.push_back(var);
+        }
+      }
+      auto cost = [this](clauses::Variable var) {
+        return numOccurrences({var, true}) * numOccurrences({var, false});
+      };
+      std::sort(candidates.begin(), candidates.end(),
+                [&cost](clauses::Variable a, clauses::Variable b) {
+                  return cost(a) < cost(b);
+                });
+
+      auto num_eliminated = stats.num_eliminated_variables;
+      for (auto var : candidates) {
+        if (stats.num_ticks >= end_ticks) {
+          break;
+        }
+        if (literal_values.value(var).isUnset() && !tryEliminateVariable(var)) {
+          return false;
+        }
+      }
+      if (stats.num_eliminated_variables == num_eliminated) {
+        break;
+      }
+    }
+
+    // Drop occurrence lists and removed clauses; resolvents may have
+    // produced new top-level assignments
+    literal_occurrences.clear();
+    std::erase_if(original_clauses, [this](clauses::ClauseRef clause_ref) {
+      return clauseAt(clause_ref).isDeleted();
+    });
+    removeAllSatisfiedClauses();
+    return true;
+  }
+
+  /// Occurrence lists of the long original clauses; binary clauses are
+  /// found via `literals_implied_by`
+  void buildOccurrenceLists() {
+    literal_occurrences.resize(numVariables() * 2);
+    for (auto clause_ref : original_clauses) {
+      for (auto literal : clauseAt(clause_ref)) {
+        literal_occurrences[literal].push_back(clause_ref);
+      }
+    }
+  }
+
+  /// Number of (long and binary) clauses containing `literal`; may count
+  /// removed long clauses
+  std::size_t numOccurrences(clauses::Literal literal) const {
+    return literal_occurrences[literal].size() +
+           literals_implied_by[~literal].size();
+  }
+
+  /// Eliminate `var` if its resolvents do not outnumber its clauses;
+  /// returns false if a resolvent is empty (UNSAT)
+  bool tryEliminateVariable(clauses::Variable var) {
+    clauses::Literal positive(var, true);
+    clauses::Literal negative(var, false);
+    elimination_literals.clear();
+    elimination_clause_starts.clear();
+    auto num_positive = gatherOccurrences(positive);
+    auto num_negative = gatherOccurrences(negative);
+    elimination_clause_starts.push_back(elimination_literals.size());
+    if (num_positive > options::ELIM_OCCURRENCE_LIMIT ||
+        num_negative > options::ELIM_OCCURRENCE_LIMIT) {
+      return true;
+    }
+
+    // Count non-tautological resolvents
+    std::uint32_t num_resolvents = 0;
+    for (std::uint32_t i = 0; i < num_positive; ++i) {
+      for (std::uint32_t j = 0; j < num_negative; ++j) {
+        if (resolve(i, num_positive + j, var)) {
+          ++num_resolvents;
+          if (num_resolvents > num_positive + num_negative ||
+              resolvent.size() > options::ELIM_CLAUSE_SIZE_LIMIT) {
+            return true;
+          }
+        }
+      }
+    }
+
+    // Save the clauses of the smaller side for extending the model; the
+    // variable takes the other polarity unless one of them is falsified
+    bool save_positive = num_positive <= num_negative;
+    auto witness = save_positive ? positive : negative;
+    auto first = save_positive ? 0 : num_positive;
+    auto num_saved = save_positive ? num_positive : num_negative;
+    for (auto i = first; i < first + num_saved; ++i) {
+      reconstruction_stack.push(witness, eliminationClause(i));
+    }
+    std::array<clauses::Literal, 1> default_literal{~witness};
+    reconstruction_stack.push(~witness, default_literal);
+
+    // Replace the clauses of the variable by the resolvents
+    removeClausesOfLiteral(positive);
+    removeClausesOfLiteral(negative);
+    variable_eliminated[var] = true;
+    focused_heuristic.remove(var);
+    stable_heuristic.remove(var);
+    ++stats.num_eliminated_variables;
+    for (std::uint32_t i = 0; i < num_positive; ++i) {
+      for (std::uint32_t j = 0; j < num_negative; ++j) {
+        if (resolve(i, num_positive + j, var) && !addResolvent()) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// Append the clauses containing `literal` that are not satisfied at
+  /// level 0, without false literals, to `elimination_literals`; returns
+  /// their number
+  std::uint32_t gatherOccurrences(clauses::Literal literal) {
+    std::uint32_t num_clauses = 0;
+    for (auto implication : literals_implied_by[~literal]) {
+      // Binary clause `literal or implication.implied`; learned binary
+      // clauses are implied by the others and just removed
+      if (implication.is_learned || literalTrue(implication.implied)) {
+        continue;
+      }
+      elimination_clause_starts.push_back(elimination_literals.size());
+      elimination_literals.push_back(literal);
+      elimination_literals.push_back(implication.implied);
+      ++num_clauses;
+    }
+    stats.num_ticks +=
+        cacheLines<clauses::Implication>(literals_implied_by[~literal].size()) +
+        cacheLines<clauses::ClauseRef>(literal_occurrences[literal].size());
+    for (auto clause_ref : literal_occurrences[literal]) {
+      auto clause = clauseAt(clause_ref);
+      ++stats.num_ticks;
+      if (clause.isDeleted() || isClauseSatisfied(clause)) {
+        continue;
+      }
+      elimination_clause_starts.push_back(elimination_literals.size());
+      for (auto clause_literal : clause) {
+        if (!literalFalse(clause_literal)) {
+          elimination_literals.push_back(clause_literal);
+        }
+      }
+      ++num_clauses;
+    }
+    return num_clauses;
+  }
+
+  /// Clause `i` gathered by `gatherOccurrences`
+  std::span<const clauses::Literal> eliminationClause(std::uint32_t i) const {
+    return {elimination_literals.begin() + elimination_clause_starts[i],
+            elimination_literals.begin() + elimination_clause_starts[i + 1]};
+  }
+
+  /// Resolve the gathered clauses `i` and `j` on `var` into `resolvent`;
+  /// returns false if the resolvent is a tautology
+  bool resolve(std::uint32_t i, std::uint32_t j, clauses::Variable var) {
+    ++stats.num_ticks;
+    resolvent.clear();
+    for (auto literal : eliminationClause(i)) {
+      if (literal.var() != var) {
+        literal_marks[literal] = true;
+        resolvent.push_back(literal);
+      }
+    }
+    bool tautology = false;
+    for (auto literal : eliminationClause(j)) {
+      if (literal.var() == var || literal_marks[literal]) {
+        continue;
+      }
+      if (literal_marks[~literal]) {
+        tautology = true;
+        break;
+      }
+      resolvent.push_back(literal);
+    }
+    for (auto literal : eliminationClause(i)) {
+      literal_marks[literal] = false;
+    }
+    return !tautology;
+  }
+
+  /// Add `resolvent` as original clause and to the occurrence lists;
+  /// returns false if UNSAT
+  bool addResolvent() {
+    auto num_original_clauses = original_clauses.size();
+    if (!addClause(resolvent)) {
+      return false;
+    }
+    if (original_clauses.size() > num_original_clauses) {
+      auto clause_ref = original_clauses.back();
+      for (auto literal : clauseAt(clause_ref)) {
+        literal_occurrences[literal].push_back(clause_ref);
+      }
+    }
+    return true;
+  }
+
+  /// Remove all (long and binary) clauses containing `literal`
+  void removeClausesOfLiteral(clauses::Literal literal) {
+    for (auto clause_ref : literal_occurrences[literal]) {
+      if (!clauseAt(clause_ref).isDeleted()) {
+        detachClause(clause_ref);
+      }
+    }
+    literal_occurrences[literal].clear();
+
+    for (auto implication : literals_implied_by[~literal]) {
+      // Remove the other direction of binary clause
+      // `literal or implication.implied`
+      auto& other = literals_implied_by[~implication.implied];
+      auto it = std::find_if(other.begin(), other.end(),
+                             [literal](clauses::Implication other_implication) {
+                               return other_implication.implied == literal;
+                             });
+      assert(it != other.end());
+      other.erase(it);
+      if (implication.is_learned) {
+        --stats.num_learned_clauses;
+        stats.num_literals_in_learned_clauses -= 2;
+      } else {
+        --stats.num_clauses;
+        stats.num_literals_in_clauses -= 2;
+      }
+    }
+    literals_implied_by[~literal].clear();
+  }
+
+  /// Blocked clause elimination (Jarvisalo, Biere, Heule 2010) on the
+  /// original clauses: a clause is blocked on its literal `l` if all its
+  /// resolvents on `l` are tautologies; blocked clauses are removed and
+  /// saved with witness `l` for model reconstruction; stops after spending
+  /// `tick_budget` ticks
+  void eliminateBlockedClauses(std::uint64_t tick_budget) {
+    assert(decisionLevel() == 0);
+    assert(learned_clauses.empty());
+    buildOccurrenceLists();
+
+    // Check literals with few resolution partners first
+    std::vector<clauses::Literal> candidates;
+    for (clauses::Variable var = 0; var < numVariables(); ++var) {
+      for (bool polarity : {false, true}) {
+        clauses::Literal literal(var, polarity);
+        if (literal_values.value(var).isUnset() && !variable_eliminated[var] &&
+            numOccurrences(~literal) <= options::BLOCK_OCCURRENCE_LIMIT) {
+          candidates.push_back(literal);
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [this](clauses::Literal a, clauses::Literal b) {
+                return numOccurrences(~a) < numOccurrences(~b);
+              });
+
+    std::vector<clauses::Literal> blocked_binary_literals;
+    auto end_ticks = stats.num_ticks + tick_budget;
+    for (auto literal : candidates) {
+      if (stats.num_ticks >= end_ticks) {
+        break;
+      }
+      for (auto clause_ref : literal_occurrences[literal]) {
+        auto clause = clauseAt(clause_ref);
+        if (!clause.isDeleted() && isClauseBlocked(clause, literal)) {
+          reconstruction_stack.push(literal, clause);
+          detachClause(clause_ref);
+          ++stats.num_blocked_clauses;
+        }
+      }
+
+      // Binary clauses `literal or implied`
+      blocked_binary_literals.clear();
+      for (auto implication : literals_implied_by[~literal]) {
+        std::array<clauses::Literal, 2> binary_clause = {literal,
+                                                         implication.implied};
+        if (isClauseBlocked(binary_clause, literal)) {
+          blocked_binary_literals.push_back(implication.implied);
+        }
+      }
+      for (auto implied : blocked_binary_literals) {
+        std::array<clauses::Literal, 2> binary_clause = {literal, implied};
+        reconstruction_stack.push(literal, binary_clause);
+        detachBinaryClause(literal, implied);
+        ++stats.num_blocked_clauses;
+      }
+    }
+
+    literal_occurrences.clear();
+    std::erase_if(original_clauses, [this](clauses::ClauseRef clause_ref) {
+      return clauseAt(clause_ref).isDeleted();
+    });
+    checkGarbage();
+  }
+
+  /// Whether every resolvent of `clause` on `literal` with a (long or
+  /// binary) original clause is a tautology
+  bool isClauseBlocked(std::span<const clauses::Literal> clause,
+                       clauses::Literal literal) {
+    for (auto clause_literal : clause) {
+      literal_marks[~clause_literal] = true;
+    }
+    // Resolvents with clause `other` are tautologies if `other` contains
+    // the negation of another literal of `clause`
+    literal_marks[~literal] = false;
+
+    bool blocked = true;
+    stats.num_ticks +=
+        cacheLines<clauses::Implication>(literals_implied_by[literal].size()) +
+        cacheLines<clauses::ClauseRef>(literal_occurrences[~literal].size());
+    for (auto implication : literals_implied_by[literal]) {
+      if (!literal_marks[implication.implied]) {
+        blocked = false;
+        break;
+      }
+    }
+    for (auto it = literal_occurrences[~literal].begin();
+         blocked && it != literal_occurrences[~literal].end(); ++it) {
+      auto other_clause = clauseAt(*it);
+      ++stats.num_ticks;
+      if (!other_clause.isDeleted() &&
+          std::none_of(other_clause.begin(), other_clause.end(),
+                       [this](clauses::Literal other_literal) {
+                         return literal_marks[other_literal];
+                       })) {
+        blocked = false;
+      }
+    }
+
+    for (auto clause_literal : clause) {
+      literal_marks[~clause_literal] = false;
+    }
+    return blocked;
+  }
+
+  /// Remove the original binary clause `(first_literal or second_literal)`
+  void detachBinaryClause(clauses::Literal first_literal,
+                          clauses::Literal second_literal) {
+    for (auto [literal, implied] :
+         {std::pair(~first_literal, second_literal),
+          std::pair(~second_literal, first_literal)}) {
+      auto& implications = literals_implied_by[literal];
+      auto it = std::find_if(implications.begin(), implications.end(),
+                             [implied](clauses::Implication implication) {
+                               return implication.implied == implied;
+                             });
+      assert(it != implications.end() && !it->is_learned);
+      implications.erase(it);
+    }
+    --stats.num_clauses;
+    stats.num_literals_in_clauses -= 2;
+  }
+
+  /// Remove the watches of all clauses detached since the last call
+  void flushWatches() {
+    literals_watched_by.sweep([this](clauses::Watch watch) {
+      return clauseAt(watch.clause_ref).isDeleted();
+    });
+  }
+
+  /// Purge watches of detached clauses and compact the clause arena if too
+  /// many words are wasted
+  void checkGarbage() {
+    flushWatches();
+    if (clauses.wasted() >
+        static_cast<double>(clauses.size()) * options::GARBAGE_FRACTION) {
+      collectGarbage();
+    }
+  }
+
+  /// Move all live clauses to the spare arena and update all clause
+  /// references; clauses are laid out in the order in which the watch lists
+  /// are traversed
+  void collectGarbage() {
+    // The spare arena gets the full capacity of the current one so that
+    // new learned clauses fill the space freed by the collection first
+    auto& to = relocated_clauses;
+    to.clear();
+    to.reserve(clauses.capacity());
+
+    // Relocate watched clauses in watch list order
+    assert(!literals_watched_by.hasStale());
+    for (std::size_t literal = 0; literal < literals_watched_by.numLiterals();
+         ++literal) {
+      for (auto& watch : literals_watched_by[literal]) {
+        watch.clause_ref = clauses.relocate(watch.clause_ref, to);
+      }
+    }
+
+    // Update reasons of assigned variables
+    for (auto literal : trail) {
+      auto& reason = variable_metadata[literal.var()].reason;
+      if (reason.isClause()) {
+        reason = clauses.relocate(reason.clauseRef(), to);
+      }
+    }
+
+    // Update clause lists; all attached clauses are watched
+    for (auto& clause_ref : original_clauses) {
+      clause_ref = clauses.relocate(clause_ref, to);
+    }
+    for (auto& clause_ref : learned_clauses) {
+      clause_ref = clauses.relocate(clause_ref, to);
+    }
+
+    std::swap(clauses, to);
+  }
+
   /// Checks whether the given clause is satisfied
-  bool isClauseSatisfied(const std::vector<clauses::Literal>& clause) const {
+  bool isClauseSatisfied(clauses::Clause clause) const {
     for (auto literal : clause) {
       if (literalTrue(literal)) {
         return true;
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace ns::solver::vmtf {
+
+/// Variable move-to-front (VMTF) decision heuristic; variables are kept in
+/// a doubly-linked queue, bumped variables are moved to the front, and
+/// decisions pick the front-most unassigned variable
+class Vmtf {
+ private:
+  /// Marks the end of the queue
+  static constexpr clauses::Variable NONE = -1;
+
+  /// Link of a variable in the queue
+  struct Link {
+    /// Variable enqueued before (towards the back of the queue)
+    clauses::Variable prev;
+    /// Variable enqueued after (towards the front of the queue)
+    clauses::Variable next;
+    /// Enqueue timestamp; increasing from back to front
+    std::uint64_t stamp;
+  };
+
+  /// Queue links of each variable
+  std::vector<Link> links;
+  /// Least recently bumped variable
+  clauses::Variable first;
+  /// Most recently bumped variable
+  clauses::Variable last;
+  /// All variables in front of `search` are assigned
+  clauses::Variable search;
+  /// Timestamp of the next enqueued variable
+  std::uint64_t next_stamp;
+
+  /// Remove variable from the queue
+  void dequeue(clauses::Variable var) {
+    auto& link = links[var];
+    if (link.prev != NONE) {
+      links[link.prev].next = link.next;
+    } else {
+      first = link.next;
+    }
+    if (link.next != NONE) {
+      links[link.next].prev = link.prev;
+    } else {
+      last = link.prev;
+    }
+  }
+
+  /// Append variable at the front of the queue
+  void enqueue(clauses::Variable var) {
+    auto& link = links[var];
+    link.prev = last;
+    link.next = NONE;
+    link.stamp = next_stamp++;
+    if (last != NONE) {
+      links[last].next = var;
+    } else {
+      first = var;
+    }
+    last = var;
+  }
+
+ public:
+  /// Create empty queue
+  Vmtf() : links(), first(NONE), last(NONE), search(NONE), next_stamp(0) {}
+
+  /// Inits the heuristic with all variables unassigned; lower variables
+  /// are picked first
+  void createVariables(std::uint32_t num_variables) {
+    auto old_num_variables = static_cast<std::uint32_t>(links.size());
+    links.resize(num_variables);
+    for (auto var = num_variables; var > old_num_variables; --var) {
+      enqueue(var - 1);
+    }
+    search = last;
+  }
+
+  /// Enqueue timestamp of a variable
+  constexpr std::uint64_t stamp(clauses::Variable var) const noexcept {
+    return links[var].stamp;
+  }
+
+  /// Whether variable `a` would be picked before variable `b`
+  constexpr bool prefers(clauses::Variable a,
+                         clauses::Variable b) const noexcept {
+    return links[a].stamp > links[b].stamp;
+  }
+
+  /// Move a variable involved in a conflict to the front of the queue;
+  /// `search` is updated once the variable is unassigned
+  void bump(clauses::Variable var) {
+    if (var != last) {
+      dequeue(var);
+      enqueue(var);
+    }
+  }
+
+  /// Scores do not decay; the queue order already prefers recent bumps
+  constexpr void decay() noexcept {}
+
+  /// Variable became unassigned and is a decision candidate again
+  constexpr void unassign(clauses::Variable var) noexcept {
+    if (search == NONE || links[var].stamp > links[search].stamp) {
+      search = var;
+    }
+  }
+
+  /// Variable is no decision candidate anymore (e.g. eliminated)
+  void remove(clauses::Variable var) {
+    if (search == var) {
+      search = links[var].prev;
+    }
+    dequeue(var);
+  }
+
+  /// Front-most unassigned variable, if any
+  std::optional<clauses::Variable> next(
+      const clauses::LiteralValues& values) {
+    while (search != NONE && !values.value(search).isUnset()) {
+      search = links[search].prev;
+    }
+    if (search == NONE) {
+      return {};
+    }
+    return search;
+  }
+};
+
+}  // namespace ns::solver::vmtf
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "clauses.hpp"
+#include "heap.hpp"
+#include "options.hpp"
+
+namespace ns::solver::vsids {
+
+/// Exponential variable state independent decaying sum (EVSIDS) decision
+/// heuristic; instead of decaying all scores on every conflict,
+/// the bump increment grows exponentially
+class Vsids {
+ private:
+  /// Unassigned variables (and some assigned ones) ordered by score
+  heap::Heap heap;
+  /// Amount to bump variable scores with
+  double increment;
+  /// Score decay factor applied on each conflict
+  double decay_factor;
+
+ public:
+  /// Create heuristic with the default decay factor
+  Vsids() : Vsids(options::VARIABLE_ACTIVITY_DECAY) {}
+  /// Create heuristic with the given decay factor
+  explicit Vsids(double decay_factor)
+      : heap(), increment(1.0), decay_factor(decay_factor) {}
+
+  /// Inits the heuristic with all variables unassigned
+  void createVariables(std::uint32_t num_variables) {
+    heap.resize(num_variables);
+    for (clauses::Variable var = 0; var < num_variables; ++var) {
+      if (!heap.contains(var)) {
+        heap.insert(var);
+      }
+    }
+  }
+
+  /// Score of a variable
+  constexpr double score(clauses::Variable var) const noexcept {
+    return heap.score(var);
+  }
+
+  /// Whether variable `a` would be picked before variable `b`
+  constexpr bool prefers(clauses::Variable a,
+                         clauses::Variable b) const noexcept {
+    return heap.score(a) > heap.score(b);
+  }
+
+  /// Bump the score of a variable involved in a conflict
+  void bump(clauses::Variable var) {
+    auto new_score = heap.score(var) + increment;
+    heap.update(var, new_score);
+
+    // Rescale if score exceeds `1e100`
+    if (new_score > 1e100) {
+      heap.rescale(1e-100);
+      increment *= 1e-100;
+    }
+  }
+
+  /// Decay all scores after a conflict by increasing the bump increment
+  constexpr void decay() noexcept { increment *= 1 / decay_factor; }
+
+  /// Variable became unassigned and is a decision candidate again
+  void unassign(clauses::Variable var) {
+    if (!heap.contains(var)) {
+      heap.insert(var);
+    }
+  }
+
+  /// Variable is no decision candidate anymore (e.g. eliminated)
+  void remove(clauses::Variable var) {
+    if (heap.contains(var)) {
+      heap.remove(var);
+    }
+  }
+
+  /// Unassigned variable with the highest score, if any
+  std::optional<clauses::Variable> next(
+      const clauses::LiteralValues& values) {
+    while (!heap.empty()) {
+      auto var = heap.pop();
+      if (values.value(var).isUnset()) {
+        return var;
+      }
+    }
+    return {};
+  }
+};
+
+}  // namespace ns::solver::vsids
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace ns::solver::watches {
+
+/// Watch lists of all literals in one pooled backing store; the list of a
+/// literal is a segment of the pool, a full list that cannot grow in place
+/// is moved to the end of the pool, and the pool is compacted once the
+/// abandoned segments make up half of it; lists marked stale are swept in
+/// one batch
+class WatchLists {
+ private:
+  /// Capacity of a list when it first grows
+  static constexpr std::uint32_t MIN_CAPACITY = 4;
+
+  /// Part of the pool holding the watches of a literal
+  struct Segment {
+    /// Position of the first watch in the pool
+    std::uint32_t begin;
+    /// Number of watches
+    std::uint32_t size;
+    /// Number of watches that fit into the segment
+    std::uint32_t capacity;
+    /// Whether the list is marked for the next `sweep`
+    bool is_stale;
+  };
+
+  /// Watches of all literals
+  std::vector<clauses::Watch> pool;
+  /// Segment of each literal
+  std::vector<Segment> segments;
+  /// Number of pool entries in abandoned segments
+  std::size_t wasted_watches;
+  /// Literals whose lists are marked for the next `sweep`
+  std::vector<std::uint32_t> stale_literals;
+  /// Spare pool that `compact` moves the lists to; swapped with `pool`, so
+  /// that compaction reuses the buffers once they are large enough
+  std::vector<clauses::Watch> compacted_pool;
+
+  /// Capacity of a list after compaction; leaves room for at least one
+  /// more watch, so that the next push does not abandon the segment, and
+  /// keeps lists that never held a watch empty
+  static std::uint32_t compactedCapacity(const Segment& segment) noexcept {
+    if (segment.capacity == 0) {
+      return 0;
+    }
+    return std::max(MIN_CAPACITY, std::bit_ceil(segment.size + 1));
+  }
+
+  /// Double the capacity of a full list; extends the list in place if it
+  /// ends the pool and moves it to the end of the pool otherwise; kept out
+  /// of line so that `push` is inlined into propagation
+  [[gnu::noinline]] void grow(std::size_t literal) {
+    if (wasted_watches > pool.size() / 2) {
+      compact();
+    }
+    auto& segment = segments[literal];
+    auto capacity = std::max(2 * segment.capacity, MIN_CAPACITY);
+    if (segment.begin + segment.capacity != pool.size()) {
+      auto begin = static_cast<std::uint32_t>(pool.size());
+      pool.resize(pool.size() + capacity);
+      std::copy_n(pool.begin() + segment.begin, segment.size,
+                  pool.begin() + begin);
+      wasted_watches += segment.capacity;
+      segment.begin = begin;
+    } else {
+      pool.resize(segment.begin + capacity);
+    }
+    assert(pool.size() < static_cast<std::uint32_t>(-1));
+    segment.capacity = capacity;
+  }
+
+ public:
+  /// Create empty watch lists
+  WatchLists()
+      : pool(),
+        segments(),
+        wasted_watches(0),
+        stale_literals(),
+        compacted_pool() {}
+
+  /// Number of literals with a watch list
+  std::size_t numLiterals() const noexcept { return segments.size(); }
+  /// Number of watches in the pool including abandoned segments
+  std::size_t poolSize() const noexcept { return pool.size(); }
+  /// Number of pool entries in abandoned segments
+  std::size_t wasted() const noexcept { return wasted_watches; }
+
+  /// Create empty lists for literals up to `num_literals`; each literal is
+  /// marked stale at most once per `sweep`, so marking never allocates
+  void resize(std::size_t num_literals) {
+    segments.resize(num_literals, {0, 0, 0, false});
+    stale_literals.reserve(num_literals);
+  }
+
+  /// Watches of a literal; only valid until a `push` grows a list
+  std::span<clauses::Watch> operator[](std::size_t literal) {
+    auto segment = segments[literal];
+    return {pool.data() + segment.begin, segment.size};
+  }
+
+  /// Append a watch to the list of a literal; returns whether the list had
+  /// to grow, which may move any list and invalidates all spans
+  bool push(std::size_t literal, clauses::Watch watch) {
+    auto is_full = segments[literal].size == segments[literal].capacity;
+    if (is_full) [[unlikely]] {
+      grow(literal);
+    }
+    auto& segment = segments[literal];
+    pool[segment.begin + segment.size] = watch;
+    ++segment.size;
+    return is_full;
+  }
+
+  /// Keep the first `new_size` watches of the list of a literal
+  void shrink(std::size_t literal, std::size_t new_size) {
+    assert(new_size <= segments[literal].size);
+    segments[literal].size = new_size;
+  }
+
+  /// Remove a watch from the list of a literal keeping the order of the
+  /// remaining watches
+  void remove(std::size_t literal, clauses::Watch watch_to_remove) {
+    auto watches = (*this)[literal];
+    auto it = std::find(watches.begin(), watches.end(), watch_to_remove);
+    assert(it != watches.end());
+    std::copy(it + 1, watches.end(), it);
+    shrink(literal, watches.size() - 1);
+  }
+
+  /// Whether lists are marked for the next `sweep`
+  bool hasStale() const noexcept { return !stale_literals.empty(); }
+
+  /// Mark the list of a literal to be swept by the next `sweep`
+  void markStale(std::size_t literal) {
+    if (!segments[literal].is_stale) {
+      segments[literal].is_stale = true;
+      stale_literals.push_back(literal);
+    }
+  }
+
+  /// Remove the watches satisfying `predicate` from all lists marked stale;
+  /// every marked list is traversed once
+  template <typename Predicate>
+  void sweep(Predicate predicate) {
+    for (auto literal : stale_literals) {
+      auto watches = (*this)[literal];
+      auto end = std::remove_if(watches.begin(), watches.end(), predicate);
+      shrink(literal, end - watches.begin());
+      segments[literal].is_stale = false;
+    }
+    stale_literals.clear();
+  }
+
+  /// Move all lists to the spare pool without abandoned segments; each
+  /// list keeps room to grow up to the next power of two
+  void compact() {
+    std::size_t pool_size = 0;
+    for (const auto& segment : segments) {
+      pool_size += compactedCapacity(segment);
+    }
+    compacted_pool.clear();
+    compacted_pool.resize(pool_size);
+    std::uint32_t begin = 0;
+    for (auto& segment : segments) {
+      std::copy_n(pool.begin() + segment.begin, segment.size,
+                  compacted_pool.begin() + begin);
+      segment.begin = begin;
+      segment.capacity = compactedCapacity(segment);
+      begin += segment.capacity;
+    }
+    std::swap(pool, compacted_pool);
+    wasted_watches = 0;
+  }
+};
+
+}  // namespace ns::solver::watches
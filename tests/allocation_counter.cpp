@@ -0,0 +1,44 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+/// Whether to count heap allocations
+std::atomic<bool> count_allocations = false;
+/// Number of heap allocations while counting
+std::atomic<std::uint64_t> num_allocations = 0;
+}  // namespace
+
+/// Counting replacement of the global allocation function; kept in its own
+/// translation unit so that it is not inlined into allocating code
+void* operator new(std::size_t size) {
+  if (count_allocations) {
+    ++num_allocations;
+  }
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+/// Matching replacements of the global deallocation functions
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace nanosat_test::allocation_counter {
+
+void start() {
+  num_allocations = 0;
+  count_allocations = true;
+}
+
+std::uint64_t stop() {
+  count_allocations = false;
+  return num_allocations;
+}
+
+}  // namespace nanosat_test::allocation_counter
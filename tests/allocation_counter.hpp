@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nanosat_test::allocation_counter {
+
+/// Start counting global heap allocations of the test binary
+void start();
+
+/// Stop counting; returns the number of allocations since `start()`
+std::uint64_t stop();
+
+}  // namespace nanosat_test::allocation_counter
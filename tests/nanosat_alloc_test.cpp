@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "allocation_counter.hpp"
+#include "parse.hpp"
+#include "solver.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_no_allocations_per_conflict) {
+  auto solver = ns::parse::parseCnf<ns::solver::Solver>(
+      "tests/examples/success/pigeon_hole_7.cnf");
+
+  allocation_counter::start();
+  auto res = solver.solve();
+  std::uint64_t num_allocations = allocation_counter::stop();
+  ASSERT_EQ(res, ns::solver::SolverExitCode::UNSAT);
+
+  // Conflict analysis and reductions only use persistent buffers; the
+  // remaining allocations stem from preprocessing and the amortized growth
+  // of watch lists and the clause arena, which stops once their capacity
+  // suffices
+  auto num_conflicts = solver.statistics().num_total_conflicts;
+  ASSERT_GT(num_conflicts, 1000);
+  ASSERT_LT(num_allocations, num_conflicts / 4);
+}
+
+TEST(nanosat_test_suite, test_allocations_in_steady_state) {
+  auto solver = ns::parse::parseCnf<ns::solver::Solver>(
+      "tests/examples/success/pigeon_hole_8.cnf");
+
+  // Warm up until preprocessing is done and the persistent buffers have
+  // grown close to their working size
+  constexpr std::uint64_t NUM_WARM_UP_CONFLICTS = 5000;
+  constexpr std::uint64_t NUM_WINDOW_CONFLICTS = 40000;
+  ASSERT_EQ(solver.solve(NUM_WARM_UP_CONFLICTS),
+            ns::solver::SolverExitCode::UNKNOWN);
+
+  // Conflicts, restarts, reductions, garbage collection, rephasing and
+  // logging do not allocate; only the inprocessing passes scheduled in
+  // the window and the remaining growth of buffers do, which is far less
+  // than one allocation per conflict over a long window
+  allocation_counter::start();
+  auto res = solver.solve(NUM_WARM_UP_CONFLICTS + NUM_WINDOW_CONFLICTS);
+  std::uint64_t num_allocations = allocation_counter::stop();
+  ASSERT_NE(res, ns::solver::SolverExitCode::SAT);
+  auto num_conflicts =
+      solver.statistics().num_total_conflicts - NUM_WARM_UP_CONFLICTS;
+  ASSERT_GT(num_conflicts, NUM_WINDOW_CONFLICTS / 2);
+  ASSERT_LT(num_allocations, num_conflicts / 10);
+}
+
+}  // namespace nanosat_test
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "clauses.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_clause_arena_add) {
+  ns::clauses::Clauses clauses;
+  auto first = clauses.addClause({{0, true}, {1, false}}, false);
+  auto second = clauses.addClause({{2, false}, {0, false}, {1, true}}, true);
+
+  ASSERT_EQ(clauses.size(), 2 * ns::clauses::Clause::HEADER_SIZE + 5);
+  ASSERT_EQ(clauses.wasted(), 0);
+  ASSERT_EQ(clauses[first].size(), 2);
+  ASSERT_FALSE(clauses[first].isLearned());
+  ASSERT_EQ(clauses[first][1], ns::clauses::Literal(1, false));
+  ASSERT_EQ(clauses[second].size(), 3);
+  ASSERT_TRUE(clauses[second].isLearned());
+  ASSERT_EQ(clauses[second].activity(), 0.0f);
+  ASSERT_EQ(std::vector<ns::clauses::Literal>(clauses[second].begin(),
+                                              clauses[second].end()),
+            (std::vector<ns::clauses::Literal>{
+                {2, false}, {0, false}, {1, true}}));
+}
+
+TEST(nanosat_test_suite, test_clause_arena_remove_and_shrink) {
+  ns::clauses::Clauses clauses;
+  auto first = clauses.addClause({{0, true}, {1, false}, {2, true}}, false);
+  auto second = clauses.addClause({{1, true}, {2, false}}, true);
+
+  clauses.shrinkClause(first, 2);
+  ASSERT_EQ(clauses[first].size(), 2);
+  ASSERT_EQ(clauses.wasted(), 1);
+
+  clauses.removeClause(second);
+  ASSERT_TRUE(clauses[second].isDeleted());
+  ASSERT_EQ(clauses.wasted(), 1 + ns::clauses::Clause::HEADER_SIZE + 2);
+}
+
+TEST(nanosat_test_suite, test_clause_lbd_and_usage) {
+  ns::clauses::Clauses clauses;
+  auto clause_ref = clauses.addClause({{0, true}, {1, false}, {2, true}}, true);
+  auto clause = clauses[clause_ref];
+  ASSERT_EQ(clause.lbd(), 0);
+  ASSERT_EQ(clause.used(), 0);
+
+  // Header fields do not interfere with each other
+  clause.setLbd(7);
+  clause.setUsed(2);
+  clause.markDeleted();
+  ASSERT_EQ(clause.lbd(), 7);
+  ASSERT_EQ(clause.used(), 2);
+  ASSERT_TRUE(clause.isLearned());
+  ASSERT_TRUE(clause.isDeleted());
+  clause.setUsed(1);
+  clause.setLbd(3);
+  ASSERT_EQ(clause.lbd(), 3);
+  ASSERT_EQ(clause.used(), 1);
+  ASSERT_FALSE(clause.isVivified());
+  clause.markVivified();
+  clause.setUsed(3);
+  ASSERT_TRUE(clause.isVivified());
+  ASSERT_EQ(clause.used(), 3);
+  ASSERT_EQ(clause.lbd(), 3);
+}
+
+TEST(nanosat_test_suite, test_clause_arena_relocate) {
+  ns::clauses::Clauses clauses;
+  auto first = clauses.addClause({{0, true}, {1, false}}, false);
+  auto second = clauses.addClause({{1, true}, {2, false}, {3, true}}, true);
+  clauses[second].setActivity(2.5f);
+  clauses.removeClause(first);
+
+  // Relocating twice yields the same clause
+  ns::clauses::Clauses to;
+  auto relocated = clauses.relocate(second, to);
+  ASSERT_EQ(clauses.relocate(second, to), relocated);
+  ASSERT_EQ(to.size(), ns::clauses::Clause::HEADER_SIZE + 3);
+  ASSERT_EQ(to.wasted(), 0);
+
+  // Header and literals are preserved
+  ASSERT_TRUE(to[relocated].isLearned());
+  ASSERT_EQ(to[relocated].activity(), 2.5f);
+  ASSERT_EQ(std::vector<ns::clauses::Literal>(to[relocated].begin(),
+                                              to[relocated].end()),
+            (std::vector<ns::clauses::Literal>{
+                {1, true}, {2, false}, {3, true}}));
+}
+
+TEST(nanosat_test_suite, test_clause_signature) {
+  ns::clauses::Clauses clauses;
+  auto small = clauses.addClause({{1, true}, {66, false}, {3, true}}, false);
+  auto large = clauses.addClause(
+      {{3, false}, {2, true}, {1, true}, {2 + 64, false}}, false);
+
+  // Variables are hashed modulo 64 irrespective of polarity
+  ASSERT_EQ(clauses[small].signature(), 0b1110u);
+  ASSERT_EQ(clauses[large].signature(), 0b1110u);
+  ASSERT_EQ(clauses[small].signature() & ~clauses[large].signature(), 0u);
+}
+
+TEST(nanosat_test_suite, test_reason_packing) {
+  // Default reason is neither a clause nor a binary clause
+  ns::clauses::Reason none;
+  ASSERT_FALSE(none.valid());
+  ASSERT_FALSE(none.isClause());
+  ASSERT_FALSE(none.isBinary());
+  ASSERT_EQ(none, ns::clauses::Reason(ns::clauses::ClauseRef()));
+  ASSERT_EQ(none, ns::clauses::Reason(ns::clauses::Literal()));
+
+  // Clause reasons keep their offset
+  ns::clauses::Reason clause(ns::clauses::ClauseRef(42));
+  ASSERT_TRUE(clause.valid());
+  ASSERT_TRUE(clause.isClause());
+  ASSERT_FALSE(clause.isBinary());
+  ASSERT_EQ(clause.clauseRef(), ns::clauses::ClauseRef(42));
+  ASSERT_FALSE(clause.implyingLiteral().valid());
+
+  // Binary reasons keep their implying literal; offset and literal with the
+  // same representation are distinguished
+  ns::clauses::Literal literal(21, false);
+  ns::clauses::Reason binary(literal);
+  ASSERT_TRUE(binary.valid());
+  ASSERT_FALSE(binary.isClause());
+  ASSERT_TRUE(binary.isBinary());
+  ASSERT_EQ(binary.implyingLiteral(), literal);
+  ASSERT_FALSE(binary.clauseRef().valid());
+  ASSERT_FALSE(binary == clause);
+  ASSERT_EQ(ns::clauses::Reason(~literal).implyingLiteral(), ~literal);
+}
+
+TEST(nanosat_test_suite, test_literal_values) {
+  using ns::clauses::Literal;
+  ns::clauses::LiteralValues values;
+  values.resize(3);
+  for (ns::clauses::Variable var = 0; var < 3; ++var) {
+    ASSERT_TRUE(values.isUnset(Literal(var, true)));
+    ASSERT_TRUE(values.isUnset(Literal(var, false)));
+  }
+
+  // Assigning a literal makes its negation false, whichever polarity it has
+  Literal a(0, true), b(1, false), c(2, true);
+  values.assign(a);
+  values.assign(b);
+  ASSERT_TRUE(values.isTrue(a));
+  ASSERT_TRUE(values.isFalse(~a));
+  ASSERT_TRUE(values.isTrue(b));
+  ASSERT_TRUE(values.isFalse(~b));
+  ASSERT_FALSE(values.isTrue(~b));
+  ASSERT_FALSE(values.isFalse(b));
+  ASSERT_TRUE(values.isUnset(c));
+  ASSERT_TRUE(values.isUnset(~c));
+
+  // Unassigning through either literal unsets both
+  values.unassign(~a);
+  values.unassign(b);
+  for (auto literal : {a, b}) {
+    ASSERT_TRUE(values.isUnset(literal));
+    ASSERT_TRUE(values.isUnset(~literal));
+    ASSERT_FALSE(values.isTrue(literal) || values.isFalse(literal));
+  }
+
+  // Reassigning with the other polarity flips both values
+  values.assign(~b);
+  ASSERT_TRUE(values.isTrue(~b));
+  ASSERT_TRUE(values.isFalse(b));
+
+  // Growing keeps the values and adds unset literals
+  values.resize(5);
+  ASSERT_TRUE(values.isFalse(b));
+  ASSERT_TRUE(values.isUnset(Literal(4, false)));
+}
+
+}  // namespace nanosat_test
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "clauses.hpp"
+#include "heap.hpp"
+#include "vsids.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_heap_pop_order) {
+  ns::solver::heap::Heap heap;
+  heap.resize(5);
+  std::vector<double> scores{3.0, 1.0, 4.0, 1.5, 5.0};
+  for (ns::clauses::Variable var = 0; var < scores.size(); ++var) {
+    heap.update(var, scores[var]);
+    heap.insert(var);
+  }
+
+  std::vector<ns::clauses::Variable> order;
+  while (!heap.empty()) {
+    order.push_back(heap.pop());
+  }
+  ASSERT_EQ(order, (std::vector<ns::clauses::Variable>{4, 2, 0, 3, 1}));
+}
+
+TEST(nanosat_test_suite, test_heap_update) {
+  ns::solver::heap::Heap heap;
+  heap.resize(4);
+  for (ns::clauses::Variable var = 0; var < 4; ++var) {
+    heap.insert(var);
+  }
+
+  heap.update(3, 2.0);
+  heap.update(1, 1.0);
+  ASSERT_EQ(heap.top(), 3);
+  heap.update(3, 0.5);
+  ASSERT_EQ(heap.top(), 1);
+
+  // Scores of removed variables are kept
+  ASSERT_EQ(heap.pop(), 1);
+  ASSERT_FALSE(heap.contains(1));
+  heap.update(1, 3.0);
+  ASSERT_EQ(heap.top(), 3);
+  heap.insert(1);
+  ASSERT_EQ(heap.top(), 1);
+  ASSERT_EQ(heap.size(), 4);
+}
+
+TEST(nanosat_test_suite, test_heap_remove) {
+  ns::solver::heap::Heap heap;
+  heap.resize(4);
+  for (ns::clauses::Variable var = 0; var < 4; ++var) {
+    heap.update(var, var);
+    heap.insert(var);
+  }
+
+  heap.remove(3);
+  heap.remove(1);
+  ASSERT_FALSE(heap.contains(1));
+  ASSERT_EQ(heap.pop(), 2);
+  ASSERT_EQ(heap.pop(), 0);
+  ASSERT_TRUE(heap.empty());
+}
+
+TEST(nanosat_test_suite, test_vsids_next) {
+  ns::solver::vsids::Vsids vsids(0.5);
+  vsids.createVariables(3);
+  ns::clauses::LiteralValues values;
+  values.resize(3);
+
+  // Later bumps weigh more after decaying
+  vsids.bump(0);
+  vsids.decay();
+  vsids.bump(1);
+  ASSERT_GT(vsids.score(1), vsids.score(0));
+  ASSERT_TRUE(vsids.prefers(1, 0));
+  ASSERT_FALSE(vsids.prefers(2, 0));
+
+  // Assigned variables are skipped
+  values.assign({1, true});
+  ASSERT_EQ(vsids.next(values), 0);
+  values.unassign({1, true});
+  vsids.unassign(1);
+  ASSERT_EQ(vsids.next(values), 1);
+  ASSERT_EQ(vsids.next(values), 2);
+  ASSERT_EQ(vsids.next(values), std::nullopt);
+}
+
+}  // namespace nanosat_test
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "inprocessing.hpp"
+#include "options.hpp"
+#include "parse.hpp"
+#include "solver.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_inprocessing_schedule_conflicts) {
+  ns::solver::inprocessing::Schedule schedule(100, 50, 0.1, 1000);
+  ASSERT_FALSE(schedule.isDue(99));
+  ASSERT_TRUE(schedule.isDue(100));
+
+  // The interval grows by the increment after each run
+  schedule.onRun(120, 0);
+  ASSERT_FALSE(schedule.isDue(269));
+  ASSERT_TRUE(schedule.isDue(270));
+  schedule.onRun(270, 0);
+  ASSERT_FALSE(schedule.isDue(469));
+  ASSERT_TRUE(schedule.isDue(470));
+}
+
+TEST(nanosat_test_suite, test_inprocessing_schedule_budget) {
+  ns::solver::inprocessing::Schedule schedule(100, 50, 0.1, 1000);
+
+  // At least the minimum budget, otherwise a fraction of the search ticks
+  // since the last run
+  ASSERT_EQ(schedule.budget(5000), 1000);
+  ASSERT_EQ(schedule.budget(50000), 5000);
+  schedule.onRun(100, 50000);
+  ASSERT_EQ(schedule.budget(60000), 1000);
+  ASSERT_EQ(schedule.budget(130000), 8000);
+}
+
+TEST(nanosat_test_suite, test_simplify_schedule) {
+  ns::solver::inprocessing::SimplifySchedule schedule;
+  ASSERT_TRUE(schedule.isDue(0));
+
+  // Without new top-level assignments, no run is due however many literals
+  // have been propagated
+  schedule.onRun(5, 100);
+  for (std::uint32_t i = 0; i < 200; ++i) {
+    ASSERT_FALSE(schedule.isDue(5));
+    schedule.onPropagation();
+  }
+
+  // New top-level assignments wait for the propagation budget
+  schedule.onRun(5, 100);
+  for (std::uint32_t i = 0; i < 100; ++i) {
+    ASSERT_FALSE(schedule.isDue(6));
+    schedule.onPropagation();
+  }
+  ASSERT_TRUE(schedule.isDue(6));
+  ASSERT_FALSE(schedule.isDue(5));
+}
+
+TEST(nanosat_test_suite, test_inprocessing_under_trail_reuse) {
+  using ns::solver::SolverExitCode;
+  auto solver = ns::parse::parseCnf<ns::solver::Solver>(
+      "tests/examples/success/pigeon_hole_7.cnf");
+  const auto& stats = solver.statistics();
+
+  // Search conflict by conflict until the next restart and the first
+  // conflict after it
+  auto solve_past_restart = [&solver, &stats]() {
+    auto num_restarts = stats.num_restarts;
+    while (stats.num_restarts == num_restarts) {
+      ASSERT_EQ(solver.solve(stats.num_total_conflicts + 1),
+                SolverExitCode::UNKNOWN);
+    }
+  };
+
+  // Vivification is due first, then probing; the first restart after a
+  // pass is due reverts the whole trail instead of reusing it
+  ASSERT_EQ(solver.solve(ns::options::VIVIFY_FIRST), SolverExitCode::UNKNOWN);
+  ASSERT_EQ(stats.num_inprocessings, 0);
+  solve_past_restart();
+  ASSERT_EQ(stats.num_inprocessings, 1);
+  ASSERT_EQ(solver.solve(ns::options::PROBE_FIRST), SolverExitCode::UNKNOWN);
+  ASSERT_EQ(stats.num_inprocessings, 1);
+  solve_past_restart();
+  ASSERT_EQ(stats.num_inprocessings, 2);
+
+  // Restarts without due passes still reuse the trail
+  ASSERT_GT(stats.num_reused_levels, 0);
+}
+
+}  // namespace nanosat_test
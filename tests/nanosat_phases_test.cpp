@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "clauses.hpp"
+#include "phases.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_target_phases) {
+  using ns::clauses::Literal;
+  ns::solver::phases::TargetPhases target;
+  target.resize(4);
+  ASSERT_EQ(target.size(), 0);
+
+  // Without a target, decisions follow the saved phase
+  for (ns::clauses::Variable var = 0; var < 4; ++var) {
+    ASSERT_FALSE(target.contains(var));
+    ASSERT_TRUE(target.phase(var, true));
+    ASSERT_FALSE(target.phase(var, false));
+  }
+
+  // Variables in the target follow the target phase
+  std::vector<Literal> assignment = {Literal(0, true), Literal(1, false)};
+  target.assign(assignment);
+  ASSERT_EQ(target.size(), 2);
+  ASSERT_TRUE(target.phase(0, false));
+  ASSERT_FALSE(target.phase(1, true));
+  ASSERT_FALSE(target.phase(2, false));
+  ASSERT_TRUE(target.phase(2, true));
+
+  // A new target replaces the old one completely
+  assignment = {Literal(2, false), Literal(3, true), Literal(1, true)};
+  target.assign(assignment);
+  ASSERT_EQ(target.size(), 3);
+  ASSERT_FALSE(target.contains(0));
+  ASSERT_FALSE(target.phase(0, false));
+  ASSERT_TRUE(target.phase(1, false));
+  ASSERT_FALSE(target.phase(2, true));
+  ASSERT_TRUE(target.phase(3, false));
+
+  // After a reset, all variables follow the saved phase again
+  target.reset();
+  ASSERT_EQ(target.size(), 0);
+  for (ns::clauses::Variable var = 0; var < 4; ++var) {
+    ASSERT_FALSE(target.contains(var));
+    ASSERT_TRUE(target.phase(var, true));
+  }
+}
+
+}  // namespace nanosat_test
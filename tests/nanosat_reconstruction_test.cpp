@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "clauses.hpp"
+#include "reconstruction.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_reconstruction_extend) {
+  // Variable 0 eliminated from `(0 or 1)` and `(not 0 or 2)`; the negative
+  // side is saved with the positive default
+  ns::clauses::Literal x0(0, true);
+  ns::clauses::Literal x1(1, true);
+  ns::clauses::Literal x2(2, true);
+  ns::solver::reconstruction::ReconstructionStack stack;
+  std::array<ns::clauses::Literal, 2> negative_clause{~x0, x2};
+  std::array<ns::clauses::Literal, 1> default_literal{x0};
+  stack.push(~x0, negative_clause);
+  stack.push(x0, default_literal);
+  ASSERT_EQ(stack.size(), 2);
+
+  // Default satisfies the negative clause if 2 is true
+  std::vector<ns::clauses::VariableValue> values{{}, false, true};
+  stack.extend(values);
+  ASSERT_EQ(values[0], true);
+
+  // Otherwise the negative clause flips the variable
+  values = {{}, true, false};
+  stack.extend(values);
+  ASSERT_EQ(values[0], false);
+}
+
+}  // namespace nanosat_test
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "options.hpp"
+#include "restart.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_moving_average) {
+  ns::solver::restart::ExponentialMovingAverage average(0.5);
+  ASSERT_EQ(average.value(), 0.0);
+
+  // Bias correction yields the exact value after the first update
+  average.update(4.0);
+  ASSERT_DOUBLE_EQ(average.value(), 4.0);
+  average.update(8.0);
+  ASSERT_GT(average.value(), 4.0);
+  ASSERT_LT(average.value(), 8.0);
+}
+
+TEST(nanosat_test_suite, test_luby_restart_intervals) {
+  ns::solver::restart::LubyRestart restart;
+  std::uint64_t first = ns::options::STABLE_RESTART_FIRST;
+
+  // Intervals follow `1,1,2,1,1,2,4` times the unit
+  for (std::uint64_t units : {1, 1, 2, 1, 1, 2, 4}) {
+    for (std::uint64_t conflict = 0; conflict < units * first; ++conflict) {
+      ASSERT_FALSE(restart.shouldRestart());
+      restart.onConflict();
+    }
+    ASSERT_TRUE(restart.shouldRestart());
+    restart.onRestart();
+  }
+}
+
+TEST(nanosat_test_suite, test_glucose_restart) {
+  ns::solver::restart::GlucoseRestart restart;
+
+  // Constant literal block distances never trigger a restart
+  for (std::uint64_t conflict = 0; conflict < 200; ++conflict) {
+    restart.onConflict(5, 100);
+    ASSERT_FALSE(restart.shouldRestart());
+  }
+
+  // Recent clauses with much higher distances trigger a restart
+  for (std::uint64_t conflict = 0;
+       conflict < ns::options::RESTART_MIN_CONFLICTS; ++conflict) {
+    restart.onConflict(20, 100);
+  }
+  ASSERT_TRUE(restart.shouldRestart());
+  restart.onRestart();
+  ASSERT_FALSE(restart.shouldRestart());
+}
+
+}  // namespace nanosat_test
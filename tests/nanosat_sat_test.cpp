@@ -94,4 +94,223 @@ TEST(nanosat_test_suite, test_big_sat_instance) {
   }
 }
 
+TEST(nanosat_test_suite, test_equivalence_chain) {
+  // Chain of inverters and buffers `x0 = not x1`, `x1 = x2`,
+  // `x2 = not x3`, ... and long clauses over the chain
+  constexpr std::uint32_t num_variables = 12;
+  std::vector<std::vector<ns::clauses::Literal>> clauses;
+  for (std::uint32_t var = 0; var + 1 < num_variables; ++var) {
+    bool polarity = var % 2 == 1;
+    clauses.push_back({{var, false}, {var + 1, polarity}});
+    clauses.push_back({{var, true}, {var + 1, !polarity}});
+  }
+  clauses.push_back({{11, true}, {4, true}, {7, false}});
+  clauses.push_back({{11, true}, {5, true}, {0, false}});
+
+  ns::solver::Solver solver;
+  solver.createVariables(num_variables);
+  for (auto& clause : clauses) {
+    ASSERT_TRUE(solver.addClause(clause));
+  }
+
+  // Check SAT model
+  auto res = solver.solve();
+  ASSERT_EQ(res, ns::solver::SolverExitCode::SAT);
+  for (auto& clause : clauses) {
+    bool contains_true_literal = false;
+    for (auto lit : clause) {
+      if (solver.model()[lit.var()] == lit.polarity()) {
+        contains_true_literal = true;
+        break;
+      }
+    }
+    ASSERT_TRUE(contains_true_literal);
+  }
+}
+
+TEST(nanosat_test_suite, test_blocked_clauses) {
+  // `(x0 or x1 or x2)` is blocked on x0 since its resolvents with
+  // `(not x0 or not x1 or x3)` and `(not x0 or not x2 or x3)` are
+  // tautologies; the model must still satisfy it
+  std::vector<std::vector<ns::clauses::Literal>> clauses = {
+      {{0, true}, {1, true}, {2, true}},
+      {{0, false}, {1, false}, {3, true}},
+      {{0, false}, {2, false}, {3, true}},
+      {{1, false}, {4, true}, {5, true}},
+      {{2, false}, {4, false}, {5, true}},
+      {{3, false}, {4, true}, {5, false}},
+      {{1, false}, {2, false}, {5, false}},
+      {{5, false}, {4, false}, {1, false}},
+  };
+
+  ns::solver::Solver solver;
+  solver.createVariables(6);
+  for (auto& clause : clauses) {
+    ASSERT_TRUE(solver.addClause(clause));
+  }
+
+  // Check SAT model
+  auto res = solver.solve();
+  ASSERT_EQ(res, ns::solver::SolverExitCode::SAT);
+  for (auto& clause : clauses) {
+    bool contains_true_literal = false;
+    for (auto lit : clause) {
+      if (solver.model()[lit.var()] == lit.polarity()) {
+        contains_true_literal = true;
+        break;
+      }
+    }
+    ASSERT_TRUE(contains_true_literal);
+  }
+  ASSERT_GT(solver.statistics().num_blocked_clauses, 0);
+}
+
+TEST(nanosat_test_suite, test_equivalence_cycle_unsat) {
+  // `x0 = x1 = x2 = not x0` together with a long clause
+  ns::solver::Solver solver;
+  solver.createVariables(4);
+  ASSERT_TRUE(solver.addClause({{0, false}, {1, true}}));
+  ASSERT_TRUE(solver.addClause({{0, true}, {1, false}}));
+  ASSERT_TRUE(solver.addClause({{1, false}, {2, true}}));
+  ASSERT_TRUE(solver.addClause({{1, true}, {2, false}}));
+  ASSERT_TRUE(solver.addClause({{2, false}, {0, false}}));
+  ASSERT_TRUE(solver.addClause({{2, true}, {0, true}}));
+  ASSERT_TRUE(solver.addClause({{0, true}, {2, true}, {3, true}}));
+
+  ASSERT_EQ(solver.solve(), ns::solver::SolverExitCode::UNSAT);
+}
+
+TEST(nanosat_test_suite, test_failed_literals_and_hyper_binaries) {
+  using ns::clauses::Literal;
+  // Probing `f` assigns `g` and `h`, which imply both `x` and `not x`, so
+  // `f` fails; probing `r` assigns `a`, `b`, `d` through binary clauses and
+  // `c` through `not b or not d or c`, whose dominator `a` yields the
+  // resolvent `not a or c`
+  enum : std::uint32_t { f, g, h, x, r, a, b, d, c, num_gadget_variables };
+  std::vector<std::vector<Literal>> clauses = {
+      {{f, false}, {g, true}},
+      {{f, false}, {h, true}},
+      {{g, false}, {h, false}, {x, true}},
+      {{g, false}, {h, false}, {x, false}},
+      {{r, false}, {a, true}},
+      {{a, false}, {b, true}},
+      {{a, false}, {d, true}},
+      {{b, false}, {d, false}, {c, true}},
+  };
+
+  // Ternary clauses with a cycle of padding variables keep all variables
+  // from being eliminated and all clauses from being blocked
+  constexpr std::uint32_t num_padding_variables = 17;
+  for (std::uint32_t var = 0; var < num_gadget_variables; ++var) {
+    for (std::uint32_t i = 0; i < num_padding_variables; ++i) {
+      std::uint32_t first = num_gadget_variables + i;
+      std::uint32_t second =
+          num_gadget_variables + (i + 1) % num_padding_variables;
+      clauses.push_back({{var, true}, {first, true}, {second, true}});
+      clauses.push_back({{var, false}, {first, false}, {second, false}});
+    }
+  }
+
+  ns::solver::Solver solver;
+  solver.createVariables(num_gadget_variables + num_padding_variables);
+  for (auto& clause : clauses) {
+    ASSERT_TRUE(solver.addClause(clause));
+  }
+
+  // Preprocessing probes all roots before the search starts
+  ASSERT_EQ(solver.solve(0), ns::solver::SolverExitCode::UNKNOWN);
+  ASSERT_EQ(solver.statistics().num_blocked_clauses, 0);
+  ASSERT_EQ(solver.statistics().num_eliminated_variables, 0);
+  ASSERT_EQ(solver.statistics().num_failed_literals, 1);
+  ASSERT_EQ(solver.statistics().num_hyper_binary_resolvents, 1);
+
+  // The failed literal is false in every model
+  ASSERT_EQ(solver.solve(), ns::solver::SolverExitCode::SAT);
+  ASSERT_FALSE(solver.model()[f] == true);
+  for (auto& clause : clauses) {
+    bool contains_true_literal = false;
+    for (auto lit : clause) {
+      if (solver.model()[lit.var()] == lit.polarity()) {
+        contains_true_literal = true;
+        break;
+      }
+    }
+    ASSERT_TRUE(contains_true_literal);
+  }
+}
+
+TEST(nanosat_test_suite, test_learned_clause_minimization) {
+  auto solver = ns::parse::parseCnf<ns::solver::Solver>(
+      "tests/examples/success/medium_sat.cnf");
+  auto mock_solver =
+      ns::parse::parseCnf<SolverMock>("tests/examples/success/medium_sat.cnf");
+
+  // Both shrinking and binary minimization remove literals from learned
+  // clauses, and the shortened clauses keep the model correct
+  auto res = solver.solve();
+  ASSERT_EQ(res, ns::solver::SolverExitCode::SAT);
+  ASSERT_GT(solver.statistics().num_shrunk_literals, 0);
+  ASSERT_GT(solver.statistics().num_binary_minimized_literals, 0);
+  for (auto& clause : mock_solver.clauses) {
+    bool contains_true_literal = false;
+    for (auto lit : clause) {
+      if (solver.model()[lit.var()] == lit.polarity()) {
+        contains_true_literal = true;
+        break;
+      }
+    }
+    ASSERT_TRUE(contains_true_literal);
+  }
+
+  // The shortened clauses stay implied by the formula: an unsatisfiable
+  // formula is still refuted
+  auto unsat_solver = ns::parse::parseCnf<ns::solver::Solver>(
+      "tests/examples/success/pigeon_hole_7.cnf");
+  ASSERT_EQ(unsat_solver.solve(), ns::solver::SolverExitCode::UNSAT);
+  ASSERT_GT(unsat_solver.statistics().num_shrunk_literals, 0);
+  ASSERT_GT(unsat_solver.statistics().num_binary_minimized_literals, 0);
+}
+
+TEST(nanosat_test_suite, test_binary_implications) {
+  // Binary clauses `x0 -> x1 -> ... -> x9` and unit `x0`
+  constexpr std::uint32_t num_variables = 10;
+  auto add_chain = [](ns::solver::Solver& solver) {
+    solver.createVariables(num_variables + 1);
+    for (std::uint32_t var = 0; var + 1 < num_variables; ++var) {
+      ASSERT_TRUE(solver.addClause({{var, false}, {var + 1, true}}));
+    }
+    ASSERT_TRUE(solver.addClause({{0, true}}));
+  };
+
+  // The unit propagates through the whole chain: a clause with the last
+  // variable is satisfied and its negation is a conflict
+  ns::solver::Solver solver;
+  add_chain(solver);
+  ASSERT_TRUE(solver.addClause(
+      {{num_variables - 1, true}, {num_variables, false}, {3, false}}));
+  ASSERT_EQ(solver.numClauses(), num_variables - 1);
+  ns::solver::Solver conflicting_solver;
+  add_chain(conflicting_solver);
+  ASSERT_FALSE(conflicting_solver.addClause({{num_variables - 1, false}}));
+
+  // The model follows the chain
+  ASSERT_EQ(solver.solve(), ns::solver::SolverExitCode::SAT);
+  for (std::uint32_t var = 0; var < num_variables; ++var) {
+    ASSERT_TRUE(solver.model()[var].isTrue());
+  }
+
+  // Binary clauses `x0 -> ... -> x9 -> not x0` and `not x0 -> x10 -> x0`
+  // contain no long clause; refuting them only uses binary reasons
+  ns::solver::Solver unsat_solver;
+  unsat_solver.createVariables(num_variables + 1);
+  for (std::uint32_t var = 0; var + 1 < num_variables; ++var) {
+    ASSERT_TRUE(unsat_solver.addClause({{var, false}, {var + 1, true}}));
+  }
+  ASSERT_TRUE(
+      unsat_solver.addClause({{num_variables - 1, false}, {0, false}}));
+  ASSERT_TRUE(unsat_solver.addClause({{0, true}, {num_variables, true}}));
+  ASSERT_TRUE(unsat_solver.addClause({{num_variables, false}, {0, true}}));
+  ASSERT_EQ(unsat_solver.solve(), ns::solver::SolverExitCode::UNSAT);
+}
+
 }  // namespace nanosat_test
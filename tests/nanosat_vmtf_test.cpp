@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "clauses.hpp"
+#include "vmtf.hpp"
+
+namespace nanosat_test {
+
+TEST(nanosat_test_suite, test_vmtf_initial_order) {
+  ns::solver::vmtf::Vmtf vmtf;
+  vmtf.createVariables(3);
+  ns::clauses::LiteralValues values;
+  values.resize(3);
+
+  ASSERT_EQ(vmtf.next(values), 0);
+  values.assign({0, true});
+  ASSERT_EQ(vmtf.next(values), 1);
+  values.assign({1, false});
+  ASSERT_EQ(vmtf.next(values), 2);
+  values.assign({2, true});
+  ASSERT_EQ(vmtf.next(values), std::nullopt);
+}
+
+TEST(nanosat_test_suite, test_vmtf_bump_and_unassign) {
+  ns::solver::vmtf::Vmtf vmtf;
+  vmtf.createVariables(4);
+  ns::clauses::LiteralValues values;
+  values.resize(4);
+  for (ns::clauses::Variable var = 0; var < 4; ++var) {
+    values.assign({var, true});
+  }
+
+  // Bumped variables move to the front in bump order
+  vmtf.bump(3);
+  vmtf.bump(1);
+  ASSERT_GT(vmtf.stamp(1), vmtf.stamp(3));
+  ASSERT_GT(vmtf.stamp(3), vmtf.stamp(0));
+  ASSERT_TRUE(vmtf.prefers(1, 3));
+  ASSERT_FALSE(vmtf.prefers(0, 3));
+
+  // Unassigning moves the search position to the front-most candidate
+  values.unassign({3, true});
+  vmtf.unassign(3);
+  values.unassign({0, true});
+  vmtf.unassign(0);
+  ASSERT_EQ(vmtf.next(values), 3);
+  values.unassign({1, true});
+  vmtf.unassign(1);
+  ASSERT_EQ(vmtf.next(values), 1);
+  values.assign({1, true});
+  values.assign({3, false});
+  ASSERT_EQ(vmtf.next(values), 0);
+}
+
+}  // namespace nanosat_test
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "clauses.hpp"
+#include "watches.hpp"
+
+namespace nanosat_test {
+
+namespace {
+
+/// Clause references in the list of a literal
+std::vector<std::uint32_t> offsets(ns::solver::watches::WatchLists& lists,
+                                   ns::clauses::Literal literal) {
+  std::vector<std::uint32_t> result;
+  for (auto watch : lists[literal]) {
+    result.push_back(watch.clause_ref.offset());
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(nanosat_test_suite, test_watch_lists_push_and_shrink) {
+  ns::solver::watches::WatchLists lists;
+  lists.resize(4);
+  ns::clauses::Literal a(0, true), b(1, false);
+
+  // Interleaved pushes move lists to the end of the pool
+  for (std::uint32_t i = 0; i < 20; ++i) {
+    lists.push(a, {ns::clauses::ClauseRef(i), b});
+    lists.push(b, {ns::clauses::ClauseRef(100 + i), a});
+  }
+  ASSERT_EQ(lists[a].size(), 20);
+  ASSERT_EQ(lists[b].size(), 20);
+  for (std::uint32_t i = 0; i < 20; ++i) {
+    ASSERT_EQ(lists[a][i].clause_ref, ns::clauses::ClauseRef(i));
+    ASSERT_EQ(lists[a][i].blocker, b);
+    ASSERT_EQ(lists[b][i].clause_ref, ns::clauses::ClauseRef(100 + i));
+  }
+  ASSERT_GT(lists.wasted(), 0);
+  ASSERT_TRUE(lists[ns::clauses::Literal(1, true)].empty());
+
+  // Shrinking keeps the prefix and the space for new watches
+  lists.shrink(a, 2);
+  lists.push(a, {ns::clauses::ClauseRef(7), b});
+  ASSERT_EQ(offsets(lists, a), (std::vector<std::uint32_t>{0, 1, 7}));
+}
+
+TEST(nanosat_test_suite, test_watch_lists_remove_and_sweep) {
+  ns::solver::watches::WatchLists lists;
+  lists.resize(4);
+  ns::clauses::Literal a(0, true), b(1, false);
+  for (std::uint32_t i = 0; i < 6; ++i) {
+    lists.push(a, {ns::clauses::ClauseRef(i), b});
+    lists.push(b, {ns::clauses::ClauseRef(i), a});
+  }
+
+  // Removing a single watch keeps the order
+  lists.remove(a, {ns::clauses::ClauseRef(2), {}});
+  ASSERT_EQ(offsets(lists, a), (std::vector<std::uint32_t>{0, 1, 3, 4, 5}));
+
+  // Sweeping only touches the lists marked stale
+  auto is_odd = [](ns::clauses::Watch watch) {
+    return watch.clause_ref.offset() % 2 == 1;
+  };
+  lists.markStale(a);
+  lists.markStale(a);
+  ASSERT_TRUE(lists.hasStale());
+  lists.sweep(is_odd);
+  ASSERT_FALSE(lists.hasStale());
+  ASSERT_EQ(offsets(lists, a), (std::vector<std::uint32_t>{0, 4}));
+  ASSERT_EQ(offsets(lists, b), (std::vector<std::uint32_t>{0, 1, 2, 3, 4, 5}));
+  lists.markStale(b);
+  lists.sweep(is_odd);
+  ASSERT_EQ(offsets(lists, b), (std::vector<std::uint32_t>{0, 2, 4}));
+}
+
+TEST(nanosat_test_suite, test_watch_lists_compact) {
+  ns::solver::watches::WatchLists lists;
+  lists.resize(8);
+  std::vector<ns::clauses::Literal> literals;
+  for (std::uint32_t var = 0; var < 4; ++var) {
+    literals.emplace_back(var, var % 2 == 0);
+  }
+  for (std::uint32_t i = 0; i < 100; ++i) {
+    for (std::uint32_t k = 0; k < literals.size(); ++k) {
+      lists.push(literals[k], {ns::clauses::ClauseRef(k * 1000 + i), {}});
+    }
+  }
+
+  // Compaction drops abandoned segments, but each list keeps room to grow
+  // up to the next power of two; lists without watches stay empty
+  ASSERT_GT(lists.poolSize(), 4 * 128);
+  lists.compact();
+  ASSERT_EQ(lists.wasted(), 0);
+  ASSERT_EQ(lists.poolSize(), 4 * 128);
+  for (std::uint32_t k = 0; k < literals.size(); ++k) {
+    auto watches = lists[literals[k]];
+    ASSERT_EQ(watches.size(), 100);
+    for (std::uint32_t i = 0; i < 100; ++i) {
+      ASSERT_EQ(watches[i].clause_ref, ns::clauses::ClauseRef(k * 1000 + i));
+    }
+  }
+
+  // Pushing after compaction fills the spare room in place
+  for (std::uint32_t k = 0; k < literals.size(); ++k) {
+    ASSERT_FALSE(
+        lists.push(literals[k], {ns::clauses::ClauseRef(k * 1000 + 100), {}}));
+  }
+  ASSERT_EQ(lists.wasted(), 0);
+  ASSERT_EQ(lists.poolSize(), 4 * 128);
+  ASSERT_EQ(lists[literals[3]].back().clause_ref,
+            ns::clauses::ClauseRef(3 * 1000 + 100));
+}
+
+}  // namespace nanosat_test